@@ -0,0 +1,268 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Montgomery;
+using ecc::P256;
+
+/*
+ * Value-returning operators against the three-address API, on P-256 sized operands. The global allocation functions
+ * are replaced to count the calls, reported per iteration in the "allocs" counter: the three-address variants are
+ * warmed up once, then must not allocate at all.
+ */
+
+static std::atomic<size_t> allocations{0};
+
+
+/**
+ * Count and allocate a block from the C heap. All the replaced operator new go through this function, and all the
+ * replaced operator delete through release(): both stay out of line, so that the compiler never sees free() applied
+ * to the result of an inlined operator new (-Wmismatched-new-delete).
+ * @param size The block size.
+ * @param alignment The block alignment.
+ * @return The block, nullptr if the heap is exhausted.
+ */
+[[gnu::noinline]] static void *allocate(size_t size, size_t alignment) noexcept {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    size = size == 0 ? 1 : size;
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+
+    // aligned_alloc() needs a size multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+
+[[gnu::noinline]] static void release(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+
+static void *allocateOrThrow(size_t size, size_t alignment) {
+    if (void *pointer = allocate(size, alignment)) {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+
+void *operator new(size_t size) {
+    return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+
+void *operator new[](size_t size) {
+    return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+
+void *operator new(size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size, alignof(std::max_align_t));
+}
+
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size, alignof(std::max_align_t));
+}
+
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+
+void operator delete(void *pointer) noexcept {
+    release(pointer);
+}
+
+
+void operator delete[](void *pointer) noexcept {
+    release(pointer);
+}
+
+
+void operator delete(void *pointer, size_t) noexcept {
+    release(pointer);
+}
+
+
+void operator delete[](void *pointer, size_t) noexcept {
+    release(pointer);
+}
+
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+
+void operator delete(void *pointer, size_t, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+
+void operator delete[](void *pointer, size_t, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+    release(pointer);
+}
+
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+    release(pointer);
+}
+
+
+void operator delete(void *pointer, std::align_val_t, const std::nothrow_t &) noexcept {
+    release(pointer);
+}
+
+
+void operator delete[](void *pointer, std::align_val_t, const std::nothrow_t &) noexcept {
+    release(pointer);
+}
+
+
+static const UnsignedBigInteger x("48439561293906451759052585252797914202762949526041747995844080717082404635286");
+static const UnsignedBigInteger y("36134250956749795798585127919587881956611106672985015071877198253568414405109");
+
+
+/**
+ * Run a benchmark body and report its allocations per iteration.
+ */
+template<typename Body>
+static void countAllocations(benchmark::State &state, Body body) {
+    // Grows the reused buffers, twice since the multiplications swap the output and the scratch
+    body();
+    body();
+
+    const size_t before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        body();
+    }
+
+    state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(allocations.load(std::memory_order_relaxed) - before),
+            benchmark::Counter::kAvgIterations
+    );
+}
+
+
+static void BM_AddOperator(benchmark::State &state) {
+    UnsignedBigInteger out;
+    countAllocations(state, [&] {
+        out = x + y;
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_AddThreeAddress(benchmark::State &state) {
+    UnsignedBigInteger out;
+    countAllocations(state, [&] {
+        UnsignedBigInteger::add(out, x, y);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_MultiplyOperator(benchmark::State &state) {
+    UnsignedBigInteger out;
+    countAllocations(state, [&] {
+        out = x * y;
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_MultiplyThreeAddress(benchmark::State &state) {
+    UnsignedBigInteger out;
+    Digits scratch;
+    countAllocations(state, [&] {
+        UnsignedBigInteger::multiply(out, x, y, scratch);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_MontgomeryOperator(benchmark::State &state) {
+    const Montgomery *context = Montgomery::forModulus(P256::m);
+    UnsignedBigInteger out = x;
+    countAllocations(state, [&] {
+        out = context->montgomery(out, y);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_MontgomeryThreeAddress(benchmark::State &state) {
+    const Montgomery *context = Montgomery::forModulus(P256::m);
+    UnsignedBigInteger out = x;
+    Digits scratch;
+    countAllocations(state, [&] {
+        context->montgomery(out, out, y, scratch);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_MulmodOperator(benchmark::State &state) {
+    const Montgomery *context = Montgomery::forModulus(P256::m);
+    UnsignedBigInteger out = x;
+    countAllocations(state, [&] {
+        out = context->multiplication(out, y);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+static void BM_MulmodThreeAddress(benchmark::State &state) {
+    const Montgomery *context = Montgomery::forModulus(P256::m);
+    UnsignedBigInteger out = x;
+    Digits scratch;
+    countAllocations(state, [&] {
+        context->multiplication(out, out, y, scratch);
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+
+BENCHMARK(BM_AddOperator);
+BENCHMARK(BM_AddThreeAddress);
+BENCHMARK(BM_MultiplyOperator);
+BENCHMARK(BM_MultiplyThreeAddress);
+BENCHMARK(BM_MontgomeryOperator);
+BENCHMARK(BM_MontgomeryThreeAddress);
+BENCHMARK(BM_MulmodOperator);
+BENCHMARK(BM_MulmodThreeAddress);
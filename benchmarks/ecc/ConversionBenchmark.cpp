@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Point;
+using ecc::P256;
+
+/*
+ * Import and export of a P-256 coordinate in decimal, hexadecimal and big-endian bytes, and SEC1 point encodings.
+ * Then decimal conversions of 1k to 100k digit values, against the former character per character algorithms (one
+ * multiply-add by 10 per parsed character, one division by 10 per printed character).
+ */
+
+static const std::string decimal = "48439561293906451759052585252797914202762949526041747995844080717082404635286";
+
+
+static void BM_ParseDecimal(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UnsignedBigInteger(decimal));
+    }
+}
+
+
+static void BM_ParseHex(benchmark::State &state) {
+    const std::string hex = UnsignedBigInteger(decimal).toHex();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UnsignedBigInteger::fromHex(hex));
+    }
+}
+
+
+static void BM_ParseBytes(benchmark::State &state) {
+    std::vector<uint8_t> bytes(32);
+    UnsignedBigInteger(decimal).toBytes(bytes);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UnsignedBigInteger::fromBytes(bytes));
+    }
+}
+
+
+static void BM_PrintDecimal(benchmark::State &state) {
+    const UnsignedBigInteger value(decimal);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value.to_string());
+    }
+}
+
+
+static void BM_PrintHex(benchmark::State &state) {
+    const UnsignedBigInteger value(decimal);
+    char output[64];
+
+    for (auto _ : state) {
+        value.toHex(output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+
+static void BM_PrintBytes(benchmark::State &state) {
+    const UnsignedBigInteger value(decimal);
+    uint8_t output[32];
+
+    for (auto _ : state) {
+        value.toBytes(output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+
+static void BM_DecodePoint(benchmark::State &state) {
+    std::vector<uint8_t> encoded(Point::encodedSize(P256::generator.curve, false));
+    P256::generator.encode(encoded, false);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Point::decode(encoded, P256::generator.curve));
+    }
+}
+
+
+static std::string randomDecimal(size_t size) {
+    std::mt19937_64 generator(42);
+    std::string decimal(size, '0');
+    for (char &character : decimal) {
+        character = static_cast<char>('0' + generator() % 10);
+    }
+    decimal[0] = '7';
+
+    return decimal;
+}
+
+
+static void BM_FromDecimal(benchmark::State &state) {
+    const std::string decimal = randomDecimal(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(UnsignedBigInteger::fromDecimal(decimal));
+    }
+}
+
+
+static void BM_FromDecimalPerCharacter(benchmark::State &state) {
+    const std::string decimal = randomDecimal(state.range(0));
+
+    for (auto _ : state) {
+        UnsignedBigInteger result(0);
+        for (char character : decimal) {
+            result = UnsignedBigInteger(10) * result + UnsignedBigInteger(character - '0');
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+
+static void BM_ToDecimal(benchmark::State &state) {
+    const UnsignedBigInteger value = UnsignedBigInteger::fromDecimal(randomDecimal(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value.to_string());
+    }
+}
+
+
+static void BM_ToDecimalPerCharacter(benchmark::State &state) {
+    const UnsignedBigInteger value = UnsignedBigInteger::fromDecimal(randomDecimal(state.range(0)));
+
+    for (auto _ : state) {
+        std::ostringstream outputStringStream;
+        UnsignedBigInteger quotient(value), remainder;
+        do {
+            quotient.divide(10, quotient, remainder);
+            outputStringStream << remainder.digits[0];
+        } while (quotient.digits.back() != 0);
+
+        std::string output(outputStringStream.str());
+        std::reverse(output.begin(), output.end());
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+
+BENCHMARK(BM_ParseDecimal);
+BENCHMARK(BM_ParseHex);
+BENCHMARK(BM_ParseBytes);
+BENCHMARK(BM_PrintDecimal);
+BENCHMARK(BM_PrintHex);
+BENCHMARK(BM_PrintBytes);
+BENCHMARK(BM_DecodePoint)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FromDecimal)->Arg(1000)->Arg(3000)->Arg(10000)->Arg(30000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FromDecimalPerCharacter)->Arg(1000)->Arg(3000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ToDecimal)->Arg(1000)->Arg(3000)->Arg(10000)->Arg(30000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ToDecimalPerCharacter)->Arg(1000)->Arg(3000)->Arg(10000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,89 @@
+#include <array>
+#include <memory_resource>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/DigitResource.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/ECDSA.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::DigitResourceScope;
+using ecc::UnsignedBigInteger;
+using ecc::Montgomery;
+using ecc::ECDSA;
+using ecc::P256;
+
+/*
+ * Throughput of the digit resources under 1, 8 and 32 threads, reported in operations per second (items_per_second):
+ * - Heap: the global allocator, shared by all the threads,
+ * - Arena: a thread-local bump arena (monotonic buffer over a 64 KiB buffer), released after each operation,
+ * - Pool: a thread-local size-class pool, which keeps its blocks from one operation to the next.
+ * The workloads are a chain of value-returning scalar multiplications modulo n, which allocates on every product, and
+ * ECDSA verification, where the point arithmetic does not allocate and the digits only hold the scalars.
+ */
+
+static const std::vector<uint8_t> digest(32, 0x5a);
+static const std::vector<uint8_t> privateKey(32, 0x17);
+static const UnsignedBigInteger scalar("48439561293906451759052585252797914202762949526041747995844080717082404635286");
+
+enum Resource {
+    HEAP, ARENA, POOL
+};
+
+
+/**
+ * Run an operation per iteration, in a scope of the selected thread-local resource.
+ */
+template<typename Operation>
+static void runWithResource(benchmark::State &state, Operation operation) {
+    thread_local std::array<std::byte, 64 * 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+    std::pmr::unsynchronized_pool_resource pool;
+
+    const auto resource = static_cast<Resource>(state.range(0));
+    std::pmr::memory_resource *selected = resource == ARENA ? static_cast<std::pmr::memory_resource *>(&arena)
+                                          : resource == POOL ? &pool : nullptr;
+
+    for (auto _ : state) {
+        {
+            DigitResourceScope scope(selected);
+            operation();
+        }
+
+        if (resource == ARENA) {
+            arena.release();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+static void BM_ScalarChain(benchmark::State &state) {
+    const Montgomery *order = Montgomery::forModulus(P256::n);
+
+    runWithResource(state, [order] {
+        UnsignedBigInteger x = scalar;
+        for (int i = 0; i < 64; ++i) {
+            x = order->multiplication(x, scalar) + UnsignedBigInteger(1);
+        }
+        benchmark::DoNotOptimize(x);
+    });
+}
+
+
+static void BM_Verify(benchmark::State &state) {
+    static const ECDSA::PublicKey publicKey = ECDSA::publicKey(privateKey);
+    static const ECDSA::Signature signature = ECDSA::sign(digest, privateKey);
+
+    runWithResource(state, [] {
+        benchmark::DoNotOptimize(ECDSA::verify(digest, signature, publicKey));
+    });
+}
+
+
+BENCHMARK(BM_ScalarChain)->ArgName("resource")->DenseRange(HEAP, POOL)
+        ->Threads(1)->Threads(8)->Threads(32)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Verify)->ArgName("resource")->DenseRange(HEAP, POOL)
+        ->Threads(1)->Threads(8)->Threads(32)->UseRealTime()->Unit(benchmark::kMicrosecond);
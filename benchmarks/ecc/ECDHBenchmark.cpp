@@ -0,0 +1,43 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/ECDH.h"
+#include "../../includes/ecc/ECDSA.h"
+
+using ecc::ECDH;
+using ecc::ECDSA;
+
+/*
+ * ECDH P-256 throughput, reported in shared secrets per second (items_per_second).
+ */
+
+static const std::vector<uint8_t> privateKey(32, 0x5a);
+
+
+static void BM_SharedSecret(benchmark::State &state) {
+    const ECDSA::PublicKey peer = ECDSA::publicKey(std::vector<uint8_t>(32, 0x33));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ECDH::sharedSecret(privateKey, peer));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+static void BM_SharedSecrets(benchmark::State &state) {
+    std::vector<ECDSA::PublicKey> peers;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        peers.push_back(ECDSA::publicKey(std::vector<uint8_t>(32, static_cast<uint8_t>(i + 1))));
+    }
+    const std::vector<std::span<const uint8_t>> spans(peers.begin(), peers.end());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ECDH::sharedSecrets(privateKey, spans));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(BM_SharedSecret)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SharedSecrets)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/ECDSA.h"
+
+using ecc::ECDSA;
+
+/*
+ * ECDSA P-256 throughput, reported in signatures per second (items_per_second).
+ */
+
+static const std::vector<uint8_t> digest(32, 0x5a);
+static const std::vector<uint8_t> privateKey = {
+        0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+        0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12, 0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21
+};
+
+
+static void BM_Sign(benchmark::State &state) {
+    ECDSA::publicKey(privateKey); // Builds the generator table out of the measurement
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ECDSA::sign(digest, privateKey));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+static void BM_Verify(benchmark::State &state) {
+    const ECDSA::PublicKey publicKey = ECDSA::publicKey(privateKey);
+    const ECDSA::Signature signature = ECDSA::sign(digest, privateKey);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ECDSA::verify(digest, signature, publicKey));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+
+
+static void BM_VerifyBatch(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const bool withRecoveryIds = state.range(1) != 0;
+    const ECDSA::PublicKey publicKey = ECDSA::publicKey(privateKey);
+    std::vector<ECDSA::Signature> signatures(count);
+    std::vector<ECDSA::BatchItem> items(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        int recoveryId;
+        signatures[i] = ECDSA::sign(digest, privateKey, &recoveryId);
+        items[i] = {digest, signatures[i], publicKey, withRecoveryIds ? recoveryId : -1};
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ECDSA::verifyBatch(items));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+
+
+BENCHMARK(BM_Sign)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Verify)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_VerifyBatch)->ArgsProduct({{16, 64, 256}, {0, 1}})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,90 @@
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Exponentiation.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Montgomery;
+using ecc::FieldElement;
+using ecc::Exponentiation;
+using ecc::P256;
+
+/*
+ * Exponentiation modulo the P-256 prime: the naive square-and-multiply loop against the window engines on a random
+ * 256-bit exponent, and the square root chain against the sliding windows on the sparse exponent (p + 1) / 4.
+ */
+
+static const UnsignedBigInteger value("48439561293906451759052585252797914202762949526041747995844080717082404635286");
+static const UnsignedBigInteger exponent("98077495972278262722305311584620826378524716498128931733536946613931853425703");
+static const UnsignedBigInteger sqrtExponent = (P256::m + UnsignedBigInteger(1)) >> 2;
+
+
+static void BM_PowNaive(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        FieldElement result = FieldElement::fromValue(P256::context->fixedOne, P256::context);
+        for (size_t i = exponent.getMostSignificantBitIndex(); i-- > 0;) {
+            result = result.square();
+            if (exponent.getBit(i)) {
+                result *= a;
+            }
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+
+static void BM_PowSlidingWindow(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Exponentiation::slidingWindow(a, exponent));
+    }
+}
+
+
+static void BM_PowFixedWindow(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Exponentiation::fixedWindow(a, exponent, 256));
+    }
+}
+
+
+static void BM_PowSlidingWindowSquareRoot(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Exponentiation::slidingWindow(a, sqrtExponent));
+    }
+}
+
+
+static void BM_PowP256SquareRoot(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Exponentiation::p256SquareRoot(a));
+    }
+}
+
+
+static void BM_MontgomeryPow(benchmark::State &state) {
+    const Montgomery *context = Montgomery::forModulus(P256::m);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(context->pow(value, exponent));
+    }
+}
+
+
+BENCHMARK(BM_PowNaive)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PowSlidingWindow)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PowFixedWindow)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PowSlidingWindowSquareRoot)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PowP256SquareRoot)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MontgomeryPow)->Unit(benchmark::kMicrosecond);
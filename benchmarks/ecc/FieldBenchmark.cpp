@@ -0,0 +1,72 @@
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Field.h"
+#include "../../includes/ecc/P256Field.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Curve.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Field;
+using ecc::P256Field;
+using ecc::FieldElement;
+using ecc::Curve;
+using ecc::Point;
+using ecc::P256;
+
+/*
+ * P-256 field backends: generic Montgomery reduction against the NIST fast (Solinas) reduction.
+ */
+
+static const Field *montgomeryField() {
+    return ecc::Montgomery::forModulus(P256::m);
+}
+
+
+static const Field *solinasField() {
+    return P256Field::instance();
+}
+
+
+template<const Field *(*Backend)()>
+static void BM_FieldMultiply(benchmark::State &state) {
+    FieldElement x(P256::generator.x.toUnsigned(), Backend());
+    const FieldElement y(P256::generator.y.toUnsigned(), Backend());
+
+    for (auto _ : state) {
+        x *= y;
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+
+template<const Field *(*Backend)()>
+static void BM_FieldSquare(benchmark::State &state) {
+    FieldElement x(P256::generator.x.toUnsigned(), Backend());
+
+    for (auto _ : state) {
+        x = x.square();
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+
+template<const Field *(*Backend)()>
+static void BM_ScalarMultiply(benchmark::State &state) {
+    const Curve *curve = Curve::forParameters(P256::a.value, P256::b.value, Backend());
+    const Point g(P256::generator.x.toUnsigned(), P256::generator.y.toUnsigned(), UnsignedBigInteger(1), curve);
+    const UnsignedBigInteger k("86518881224734392146203432476624587398735632587263501987923418275349102935617");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(g * k);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(BM_FieldMultiply, montgomeryField);
+BENCHMARK_TEMPLATE(BM_FieldMultiply, solinasField);
+BENCHMARK_TEMPLATE(BM_FieldSquare, montgomeryField);
+BENCHMARK_TEMPLATE(BM_FieldSquare, solinasField);
+BENCHMARK_TEMPLATE(BM_ScalarMultiply, montgomeryField)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_ScalarMultiply, solinasField)->Unit(benchmark::kMicrosecond);
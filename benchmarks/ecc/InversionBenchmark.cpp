@@ -0,0 +1,81 @@
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/SignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Inversion.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::SignedBigInteger;
+using ecc::Montgomery;
+using ecc::FieldElement;
+using ecc::Inversion;
+using ecc::P256;
+
+/*
+ * Inversion modulo the P-256 prime: extended Euclid on big integers against the fixed-width engines.
+ */
+
+static const UnsignedBigInteger value("48439561293906451759052585252797914202762949526041747995844080717082404635286");
+
+
+static void BM_InverseKnuth(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Montgomery::knuthModularInverse(value, P256::m));
+    }
+}
+
+
+static void BM_InverseEuclidean(benchmark::State &state) {
+    const SignedBigInteger u(value), v(P256::m);
+    SignedBigInteger x, y;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SignedBigInteger::euclidean(u, v, x, y));
+    }
+}
+
+
+static void BM_InverseBinary(benchmark::State &state) {
+    const Inversion::Value a(value), m(P256::m);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Inversion::binary(a, m));
+    }
+}
+
+
+static void BM_InverseSafegcd(benchmark::State &state) {
+    const Inversion::Value a(value), m(P256::m);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Inversion::safegcd(a, m));
+    }
+}
+
+
+static void BM_InverseFermatP256(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Inversion::fermatP256(a));
+    }
+}
+
+
+static void BM_FieldElementInverse(benchmark::State &state) {
+    const FieldElement a(value, P256::context);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.inverse());
+    }
+}
+
+
+BENCHMARK(BM_InverseKnuth)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InverseEuclidean)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InverseBinary)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InverseSafegcd)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InverseFermatP256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FieldElementInverse)->Unit(benchmark::kMicrosecond);
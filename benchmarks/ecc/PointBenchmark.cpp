@@ -0,0 +1,116 @@
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/JacobianPoint.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Point;
+using ecc::JacobianPoint;
+using ecc::P256;
+
+/*
+ * P-256 scalar multiplications with a full-size scalar: variable-time wNAF, constant-time ladder, and fixed-base
+ * table.
+ */
+
+static const UnsignedBigInteger scalar("86518881224734392146203432476624587398735632587263501987923418275349102935617");
+
+
+static void BM_VariableBase(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(P256::generator * scalar);
+    }
+}
+
+
+static void BM_Ladder(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(P256::generator.ladder(scalar));
+    }
+}
+
+
+static void BM_FixedBase(benchmark::State &state) {
+    P256::generatorTable(); // Built once, out of the measurement
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(P256::multiplyGenerator(scalar));
+    }
+}
+
+
+static void BM_FixedBaseTableBuild(benchmark::State &state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecc::FixedBaseTable(P256::generator, 256));
+    }
+}
+
+
+/*
+ * Multi-scalar multiplication methods, by number of terms: the crossovers give the dispatching of
+ * Point::multiScalarMul().
+ */
+
+static void multiScalarInputs(size_t count, std::vector<JacobianPoint> &points, std::vector<UnsignedBigInteger> &scalars) {
+    JacobianPoint base(P256::generator);
+    UnsignedBigInteger k = scalar;
+
+    for (size_t j = 0; j < count; ++j) {
+        points.push_back(base);
+        scalars.push_back(k);
+        base = base.twice() + JacobianPoint(P256::generator);
+        k = (k * k + 7) % P256::n;
+    }
+}
+
+
+static void BM_InterleavedWnaf(benchmark::State &state) {
+    std::vector<JacobianPoint> points;
+    std::vector<UnsignedBigInteger> scalars;
+    multiScalarInputs(state.range(0), points, scalars);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(JacobianPoint::interleavedWnaf(points, scalars));
+    }
+}
+
+
+static void BM_Pippenger(benchmark::State &state) {
+    std::vector<JacobianPoint> points;
+    std::vector<UnsignedBigInteger> scalars;
+    multiScalarInputs(state.range(0), points, scalars);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(JacobianPoint::pippenger(points, scalars));
+    }
+}
+
+
+static void BM_Compress(benchmark::State &state) {
+    const Point point = P256::generator * UnsignedBigInteger(12345);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(point.compress());
+    }
+}
+
+
+static void BM_Decompress(benchmark::State &state) {
+    const std::vector<uint8_t> encoded = (P256::generator * UnsignedBigInteger(12345)).compress();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Point::decompress(encoded, P256::generator.curve));
+    }
+}
+
+
+BENCHMARK(BM_VariableBase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Ladder)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FixedBase)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FixedBaseTableBuild)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Compress)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Decompress)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InterleavedWnaf)->RangeMultiplier(4)->Range(2, 512)->Arg(96)->Arg(128)->Arg(192)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Pippenger)->RangeMultiplier(4)->Range(2, 512)->Arg(96)->Arg(128)->Arg(192)->Unit(benchmark::kMillisecond);
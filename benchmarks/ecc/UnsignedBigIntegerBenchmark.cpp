@@ -0,0 +1,71 @@
+#include <random>
+#include "benchmark/benchmark.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+
+using ecc::UnsignedBigInteger;
+
+/*
+ * Multiplication and squaring crossovers. Each algorithm only applies one level of its splitting, the sub-products
+ * going through the dispatching operators: the thresholds in UnsignedBigInteger.h are the smallest sizes (in digits)
+ * where one level of Karatsuba (resp. Toom-3) beats the method below it.
+ */
+
+static UnsignedBigInteger randomUnsignedBigInteger(std::mt19937_64 &generator, size_t size) {
+    Digits digits(size);
+    for (Digit &digit : digits) {
+        digit = static_cast<Digit>(generator());
+    }
+    digits.back() |= 1;
+
+    return UnsignedBigInteger(digits);
+}
+
+
+template<UnsignedBigInteger (*Multiply)(const UnsignedBigInteger &, const UnsignedBigInteger &)>
+static void BM_Multiply(benchmark::State &state) {
+    std::mt19937_64 generator(42);
+    const UnsignedBigInteger a = randomUnsignedBigInteger(generator, state.range(0));
+    const UnsignedBigInteger b = randomUnsignedBigInteger(generator, state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Multiply(a, b));
+    }
+}
+
+
+template<UnsignedBigInteger (*Square)(const UnsignedBigInteger &)>
+static void BM_Square(benchmark::State &state) {
+    std::mt19937_64 generator(42);
+    const UnsignedBigInteger a = randomUnsignedBigInteger(generator, state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Square(a));
+    }
+}
+
+
+static void BM_Operator(benchmark::State &state) {
+    std::mt19937_64 generator(42);
+    const UnsignedBigInteger a = randomUnsignedBigInteger(generator, state.range(0));
+    const UnsignedBigInteger b = randomUnsignedBigInteger(generator, state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+}
+
+
+static void sizes(benchmark::internal::Benchmark *benchmark) {
+    for (int size : {8, 16, 24, 32, 48, 64, 96, 128, 160, 192, 224, 256, 384, 512, 1024}) {
+        benchmark->Arg(size);
+    }
+}
+
+
+BENCHMARK_TEMPLATE(BM_Multiply, UnsignedBigInteger::schoolbookMultiply)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Multiply, UnsignedBigInteger::karatsubaMultiply)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Multiply, UnsignedBigInteger::toom3Multiply)->Apply(sizes);
+BENCHMARK(BM_Operator)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Square, UnsignedBigInteger::schoolbookSquare)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Square, UnsignedBigInteger::karatsubaSquare)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Square, UnsignedBigInteger::toom3Square)->Apply(sizes);
@@ -0,0 +1,49 @@
+#ifndef INC_3A_ECC_CPP_CURVE_H
+#define INC_3A_ECC_CPP_CURVE_H
+
+#include "UnsignedBigInteger.h"
+#include "Field.h"
+#include "Montgomery.h"
+#include "FieldElement.h"
+
+namespace ecc {
+    /**
+     * Parameters of the elliptic curve y^2 = x^3 + ax + b over a prime field backend.
+     * Curves are interned like the Montgomery contexts: points only hold a pointer to their curve, which makes
+     * copying a point as cheap as copying its three coordinates.
+     */
+    class Curve {
+    public:
+        const Field *field;
+        FieldElement a;
+        FieldElement b;
+        FieldElement b3; // 3b, used by the complete addition formulas
+        bool aIsMinusThree; // Enables the cheaper doubling formulas
+
+        /**
+         * Get the interned curve of the given parameters, building it on the first call.
+         * @param pA The a coefficient.
+         * @param pB The b coefficient.
+         * @param pModulus The field prime.
+         * @return The shared curve.
+         */
+        static const Curve *forParameters(
+                const UnsignedBigInteger &pA,
+                const UnsignedBigInteger &pB,
+                const UnsignedBigInteger &pModulus
+        );
+
+        /**
+         * Get the interned curve of the given parameters over a specific field backend.
+         * @param pA The a coefficient.
+         * @param pB The b coefficient.
+         * @param pField The field backend.
+         * @return The shared curve.
+         */
+        static const Curve *forParameters(const UnsignedBigInteger &pA, const UnsignedBigInteger &pB, const Field *pField);
+
+        Curve(const UnsignedBigInteger &pA, const UnsignedBigInteger &pB, const Field *pField);
+    };
+}
+
+#endif //INC_3A_ECC_CPP_CURVE_H
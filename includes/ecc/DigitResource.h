@@ -0,0 +1,98 @@
+#ifndef INC_3A_ECC_CPP_DIGITRESOURCE_H
+#define INC_3A_ECC_CPP_DIGITRESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace ecc {
+    /**
+     * Memory resource of the big integer digits. Every thread allocates from its current resource, the global heap
+     * unless a DigitResourceScope installed another one (e.g. a std::pmr::monotonic_buffer_resource as a bump arena,
+     * or a std::pmr::unsynchronized_pool_resource as a size-class pool, which need no locking since they are only
+     * used by their thread).
+     * Each block starts with a header recording the resource it comes from, so that it is released to it whatever the
+     * resource current when it is freed.
+     */
+    class DigitResource {
+    public:
+        static const std::size_t HEADER_BYTES = alignof(std::max_align_t);
+
+
+        /**
+         * @return The resource of the current thread.
+         */
+        static std::pmr::memory_resource *current() noexcept;
+
+
+        /**
+         * Allocate a block from the resource of the current thread.
+         * @param bytes The block size.
+         * @return The block, aligned on std::max_align_t.
+         */
+        static void *allocate(std::size_t bytes);
+
+
+        /**
+         * Release a block to the resource it was allocated from.
+         * @param pointer The block.
+         * @param bytes The block size.
+         */
+        static void deallocate(void *pointer, std::size_t bytes) noexcept;
+    };
+
+
+    /**
+     * Install a digit resource on the current thread for the lifetime of the scope, then restore the previous one.
+     * Scopes nest: the shared caches (Montgomery contexts, curves, the P-256 generator table) open a heap scope, so
+     * that they may be built from any scope.
+     * The big integers allocated in a scope must not outlive its resource nor be freed by another thread when the
+     * resource is not thread-safe: a request typically runs in a scope, copies its result out (e.g. to bytes), then
+     * releases the resource.
+     */
+    class DigitResourceScope {
+    public:
+        /**
+         * @param resource The resource to allocate the digits from, nullptr for the global heap.
+         */
+        explicit DigitResourceScope(std::pmr::memory_resource *resource) noexcept;
+
+        ~DigitResourceScope();
+
+        DigitResourceScope(const DigitResourceScope &) = delete;
+
+        DigitResourceScope &operator=(const DigitResourceScope &) = delete;
+
+    private:
+        std::pmr::memory_resource *previous;
+    };
+
+
+    /**
+     * Stateless allocator of the digit vectors, over DigitResource.
+     */
+    template<typename T>
+    class DigitAllocator {
+    public:
+        typedef T value_type;
+
+        DigitAllocator() noexcept = default;
+
+        template<typename U>
+        DigitAllocator(const DigitAllocator<U> &) noexcept {}
+
+        T *allocate(std::size_t n) {
+            return static_cast<T *>(DigitResource::allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T *pointer, std::size_t n) noexcept {
+            DigitResource::deallocate(pointer, n * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(const DigitAllocator<U> &) const noexcept {
+            return true;
+        }
+    };
+}
+
+#endif //INC_3A_ECC_CPP_DIGITRESOURCE_H
@@ -3,10 +3,25 @@
 
 #include <cstdint>
 #include <vector>
+#include "DigitResource.h"
 
 typedef std::int8_t Sign;
+#ifdef ECC_DIGIT_64
+#ifndef __SIZEOF_INT128__
+#error "ECC_DIGIT_64 requires a compiler providing unsigned __int128"
+#endif
+// 64-bit digits, intermediate products are accumulated on 128 bits
+typedef std::uint64_t Digit;
+typedef unsigned __int128 DoubleDigit;
+#else
 typedef std::uint32_t Digit;
-typedef std::uint64_t Digit64;
-typedef std::vector<Digit> Digits;
+typedef std::uint64_t DoubleDigit;
+#endif
+typedef std::vector<Digit, ecc::DigitAllocator<Digit>> Digits; // Allocated from the current DigitResource
+
+#ifndef ECC_FIELD_BITS
+// Capacity of the fixed-width field elements, which must hold the largest modulus in use
+#define ECC_FIELD_BITS 256
+#endif
 
 #endif //INC_3A_ECC_CPP_ECCTYPES_H
@@ -0,0 +1,62 @@
+#ifndef INC_3A_ECC_CPP_ECDH_H
+#define INC_3A_ECC_CPP_ECDH_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "UnsignedBigInteger.h"
+#include "FieldElement.h"
+#include "Point.h"
+#include "P256.h"
+
+namespace ecc {
+    /**
+     * Elliptic curve Diffie-Hellman on P-256 (SEC1 3.3.1), on byte buffers: private keys and public keys are encoded
+     * as for ECDSA, and the shared secret is the 32-byte big-endian x-coordinate of d * Q.
+     *
+     * The product is computed with an x-only Montgomery ladder (Brier-Joye formulas on (X:Z) coordinates), which
+     * never computes y, and does the same field operations for every private key of the same group.
+     */
+    class ECDH {
+    public:
+        static const size_t SECRET_BYTES = 32;
+
+        typedef std::array<uint8_t, SECRET_BYTES> SharedSecret;
+
+
+        /**
+         * Compute the shared secret with a peer.
+         * @param privateKey The private key, 32 big-endian bytes in [1, n - 1].
+         * @param peerPublicKey The public key of the peer, uncompressed or compressed, checked to be on the curve.
+         * @return The x-coordinate of the shared point.
+         */
+        static SharedSecret sharedSecret(std::span<const uint8_t> privateKey, std::span<const uint8_t> peerPublicKey);
+
+
+        /**
+         * Compute the shared secrets of one private key with many peers. The scalar is recoded once, and the final
+         * divisions by Z share a single inversion (Montgomery's trick).
+         * @param privateKey The private key, 32 big-endian bytes in [1, n - 1].
+         * @param peerPublicKeys The public keys of the peers, uncompressed or compressed, which must all be valid.
+         * @return The shared secrets, in order.
+         */
+        static std::vector<SharedSecret> sharedSecrets(
+                std::span<const uint8_t> privateKey,
+                std::span<const std::span<const uint8_t>> peerPublicKeys
+        );
+
+
+        /**
+         * Multiply a point by a scalar with the x-only ladder.
+         * @param xP The x-coordinate of the point, which must be on the curve and different from infinity.
+         * @param k The scalar, in [1, n - 1].
+         * @param resultX The X coordinate of k * P.
+         * @param resultZ The Z coordinate of k * P, such that x(k * P) = X / Z.
+         */
+        static void ladder(const FieldElement &xP, const UnsignedBigInteger &k, FieldElement &resultX,
+                           FieldElement &resultZ);
+    };
+}
+
+#endif //INC_3A_ECC_CPP_ECDH_H
@@ -0,0 +1,136 @@
+#ifndef INC_3A_ECC_CPP_ECDSA_H
+#define INC_3A_ECC_CPP_ECDSA_H
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "UnsignedBigInteger.h"
+#include "Point.h"
+#include "P256.h"
+
+namespace ecc {
+    /**
+     * ECDSA signatures on P-256 (FIPS 186-4), on byte buffers:
+     * - private keys are 32-byte big-endian scalars in [1, n - 1],
+     * - public keys are uncompressed SEC1 points (0x04 || x || y, 65 bytes), compressed ones (0x02 or 0x03 || x,
+     *   33 bytes) are also accepted for verification,
+     * - signatures are the concatenation r || s of two 32-byte big-endian integers (64 bytes),
+     * - messages are given by their digest (e.g. SHA-256), of which the leftmost 256 bits are used.
+     *
+     * Signing multiplies the generator with the constant-time fixed-base table, and computes s = k^-1 (e + r d) with
+     * a constant-time inversion and fixed-limb Montgomery arithmetic modulo n. Verification computes
+     * u1 * G + u2 * Q with a single multi-scalar multiplication.
+     *
+     * Batches of signatures are verified with a single inversion modulo n, and, when the recovery ids are known, with
+     * a single randomized multi-scalar check over the whole batch.
+     */
+    class ECDSA {
+    public:
+        static const size_t SCALAR_BYTES = 32;
+        static const size_t PUBLIC_KEY_BYTES = 2 * SCALAR_BYTES + 1;
+        static const size_t COMPRESSED_PUBLIC_KEY_BYTES = SCALAR_BYTES + 1;
+        static const size_t SIGNATURE_BYTES = 2 * SCALAR_BYTES;
+
+        typedef std::array<uint8_t, PUBLIC_KEY_BYTES> PublicKey;
+        typedef std::array<uint8_t, SIGNATURE_BYTES> Signature;
+
+        /**
+         * A signature to verify in a batch. The spans are not owned and must outlive the verification.
+         */
+        struct BatchItem {
+            std::span<const uint8_t> digest;
+            std::span<const uint8_t> signature;
+            std::span<const uint8_t> publicKey;
+
+            /**
+             * The recovery id of the signature, -1 if unknown: bit 0 is the parity of y(R), and bit 1 is set when
+             * x(R) = r + n.
+             */
+            int recoveryId = -1;
+        };
+
+
+        /**
+         * Compute the public key of a private key.
+         * @param privateKey The private key.
+         * @return The uncompressed public key.
+         */
+        static PublicKey publicKey(std::span<const uint8_t> privateKey);
+
+
+        /**
+         * Sign a digest with a random nonce, drawn from std::random_device.
+         * @param digest The message digest.
+         * @param privateKey The private key.
+         * @param recoveryId If not null, receives the recovery id of the signature.
+         * @return The signature.
+         */
+        static Signature sign(
+                std::span<const uint8_t> digest,
+                std::span<const uint8_t> privateKey,
+                int *recoveryId = nullptr
+        );
+
+
+        /**
+         * Sign a digest with a given nonce, e.g. a deterministic RFC 6979 nonce. The nonce must be secret, and must
+         * never be used for two different digests.
+         * @param digest The message digest.
+         * @param privateKey The private key.
+         * @param nonce The nonce, 32 big-endian bytes in [1, n - 1].
+         * @param recoveryId If not null, receives the recovery id of the signature.
+         * @return The signature.
+         */
+        static Signature sign(
+                std::span<const uint8_t> digest,
+                std::span<const uint8_t> privateKey,
+                std::span<const uint8_t> nonce,
+                int *recoveryId = nullptr
+        );
+
+
+        /**
+         * Verify a signature. Malformed signatures and public keys are rejected, not reported as errors.
+         * @param digest The message digest.
+         * @param signature The signature.
+         * @param publicKey The public key, uncompressed or compressed.
+         * @return true if the signature is valid.
+         */
+        static bool verify(
+                std::span<const uint8_t> digest,
+                std::span<const uint8_t> signature,
+                std::span<const uint8_t> publicKey
+        );
+
+
+        /**
+         * Verify a batch of signatures. The inverses of the s components are computed with a single inversion
+         * (Montgomery's trick). If every item has a recovery id, the whole batch is first checked at once with the
+         * randomized equation sum(z_i * (u1_i * G + u2_i * Q_i - R_i)) = 0, where the z_i are random 128-bit
+         * integers; the items are verified one by one only when this check fails, to locate the invalid signatures.
+         * @param items The signatures to verify.
+         * @return The validity of every signature, in order.
+         */
+        static std::vector<bool> verifyBatch(std::span<const BatchItem> items);
+
+
+        /**
+         * Decode and validate a public key, see Point::decode(): the coordinates must be reduced and the point must be
+         * on the curve. Compressed keys are decompressed with the square root chain of the P-256 prime.
+         * @param publicKey The public key, uncompressed or compressed.
+         * @return The public key point, with z = 1.
+         */
+        static Point decodePublicKey(std::span<const uint8_t> publicKey);
+
+
+        /**
+         * Convert a digest to an integer (bits2int): its leftmost 256 bits, reduced modulo n.
+         * @param digest The message digest.
+         * @return The integer e.
+         */
+        static UnsignedBigInteger digestToInteger(std::span<const uint8_t> digest);
+    };
+}
+
+#endif //INC_3A_ECC_CPP_ECDSA_H
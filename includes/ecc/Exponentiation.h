@@ -0,0 +1,157 @@
+#ifndef INC_3A_ECC_CPP_EXPONENTIATION_H
+#define INC_3A_ECC_CPP_EXPONENTIATION_H
+
+#include <vector>
+#include "UnsignedBigInteger.h"
+#include "FieldElement.h"
+
+namespace ecc {
+    /**
+     * Modular exponentiation engines, on field elements (hence on a Montgomery-form accumulator for the Montgomery
+     * backend):
+     * - slidingWindow: left-to-right sliding windows over the odd powers of the base, in variable time, for public
+     *   exponents,
+     * - fixedWindow: fixed 4-bit windows with a masked table lookup, in constant time, for secret exponents,
+     * - p256Inverse and p256SquareRoot: fixed addition chains of the P-256 prime, in constant time,
+     * - squareRoot: square roots in any odd prime field, with the P-256 chain, the exponent (p + 1) / 4 when
+     *   p = 3 mod 4, or Tonelli-Shanks otherwise.
+     */
+    class Exponentiation {
+    public:
+        static const unsigned FIXED_WIDTH = 4;
+
+
+        /**
+         * Get the sliding window width for an exponent size, which balances the precomputation of the 2^(w - 1) odd
+         * powers against the multiplications saved on the exponent.
+         * @param exponentBits The exponent size in bits.
+         * @return The window width, between 1 and 6.
+         */
+        static unsigned windowWidth(size_t exponentBits);
+
+
+        /**
+         * Variable-time left-to-right sliding window exponentiation, generic over the element type so that it may run
+         * on field elements as well as on big integers in the Montgomery domain.
+         * @param base The base.
+         * @param one The neutral element.
+         * @param exponent The exponent.
+         * @param multiply The multiplication, called as multiply(a, b).
+         * @param square The squaring, called as square(a).
+         * @return base^exponent.
+         */
+        template<typename T, typename Multiply, typename Square>
+        static T slidingWindow(const T &base, const T &one, const UnsignedBigInteger &exponent, Multiply multiply,
+                               Square square) {
+            const size_t bits = exponent.getMostSignificantBitIndex();
+            if (bits == 0) {
+                return one;
+            }
+
+            // odd[i] = base^(2i + 1)
+            const unsigned width = windowWidth(bits);
+            std::vector<T> odd{base};
+            if (width > 1) {
+                const T base2 = square(base);
+                for (size_t i = 1; i < (size_t(1) << (width - 1)); ++i) {
+                    odd.push_back(multiply(odd.back(), base2));
+                }
+            }
+
+            // The first window starts the accumulator, which saves squaring the neutral element
+            T result = one;
+            bool started = false;
+
+            for (size_t i = bits; i-- > 0;) {
+                if (!exponent.getBit(i)) {
+                    result = square(result);
+                    continue;
+                }
+
+                // The longest window exponent[i..j] of at most width bits ending with a set bit
+                size_t j = i + 1 > width ? i + 1 - width : 0;
+                while (!exponent.getBit(j)) {
+                    ++j;
+                }
+
+                size_t window = 0;
+                for (size_t b = i + 1; b-- > j;) {
+                    window = (window << 1) | exponent.getBit(b);
+                }
+
+                if (started) {
+                    for (size_t b = j; b <= i; ++b) {
+                        result = square(result);
+                    }
+                    result = multiply(result, odd[window >> 1]);
+                } else {
+                    result = odd[window >> 1];
+                    started = true;
+                }
+
+                i = j;
+            }
+
+            return result;
+        }
+
+
+        /**
+         * Variable-time sliding window exponentiation of a field element.
+         * @param base The base.
+         * @param exponent The exponent.
+         * @return base^exponent.
+         */
+        static FieldElement slidingWindow(const FieldElement &base, const UnsignedBigInteger &exponent);
+
+
+        /**
+         * Constant-time fixed window exponentiation of a field element: the exponent is copied to fixed-size digits
+         * and read in bits / 4 windows whatever its value, every window does 4 squarings and one multiplication, and
+         * the table entries are all read and selected with masks.
+         * @param base The base.
+         * @param exponent The secret exponent, lower than 2^bits.
+         * @param bits The fixed exponent size in bits, at most the width of the field elements.
+         * @return base^exponent.
+         */
+        static FieldElement fixedWindow(const FieldElement &base, const UnsignedBigInteger &exponent, size_t bits);
+
+
+        /**
+         * Compute a^(p - 2) in the P-256 field, i.e. a^-1 for a non-zero element (Fermat's little theorem), through
+         * a fixed chain of 255 squarings and 12 multiplications.
+         * @param a The element, of a field of modulus p = 2^256 - 2^224 + 2^192 + 2^96 - 1.
+         * @return a^(p - 2).
+         */
+        static FieldElement p256Inverse(const FieldElement &a);
+
+
+        /**
+         * Compute a^((p + 1) / 4) in the P-256 field, which is a square root of a when a is a square (p = 3 mod 4),
+         * through a fixed chain of 253 squarings and 9 multiplications. The caller has to square the result back to
+         * know whether a is a square.
+         * @param a The element, of a field of modulus p = 2^256 - 2^224 + 2^192 + 2^96 - 1.
+         * @return a^((p + 1) / 4).
+         */
+        static FieldElement p256SquareRoot(const FieldElement &a);
+
+
+        /**
+         * Compute a candidate square root in a prime field: a^((p + 1) / 4) when p = 3 mod 4 (with the fixed chain for
+         * the P-256 prime), Tonelli-Shanks otherwise. Like p256SquareRoot(), the result is only a square root when a
+         * is a square, which the caller has to check. The time depends on the modulus, not on a when p = 3 mod 4.
+         * @param a The element, of a field of odd prime modulus p.
+         * @return A square root of a if a is a square.
+         */
+        static FieldElement squareRoot(const FieldElement &a);
+
+
+        /**
+         * @param field A field backend.
+         * @return true if the modulus of the field is the P-256 prime.
+         */
+        static bool isP256(const Field *field);
+    };
+}
+
+#endif //INC_3A_ECC_CPP_EXPONENTIATION_H
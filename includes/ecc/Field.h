@@ -0,0 +1,58 @@
+#ifndef INC_3A_ECC_CPP_FIELD_H
+#define INC_3A_ECC_CPP_FIELD_H
+
+#include "UnsignedBigInteger.h"
+#include "FixedUnsignedInteger.h"
+
+namespace ecc {
+    /**
+     * Prime field arithmetic backend, on which field elements run. A backend chooses how the elements are represented
+     * (e.g. in the Montgomery domain) and how products are reduced; additions and subtractions only need the modulus.
+     * Backends are shared by all the elements of the field and must outlive them.
+     */
+    class Field {
+    public:
+        static const size_t FIELD_LIMBS = ECC_FIELD_BITS / UnsignedBigInteger::BITS;
+
+        typedef FixedUnsignedInteger<FIELD_LIMBS> Value;
+
+        UnsignedBigInteger modulus;
+        size_t limbs = 0; // Number of modulus digits
+        Value fixedModulus; // Only set when the modulus fits in FIELD_LIMBS digits
+        Value fixedOne; // One in the representation of the backend
+        Value fixedInverseFactor; // Maps the plain inverse of a represented value to the represented inverse
+
+        virtual ~Field() = default;
+
+        /**
+         * Field multiplication in the representation of the backend. The result may alias a or b.
+         * @param result The product.
+         * @param a The first operand, lower than the modulus.
+         * @param b The second operand, lower than the modulus.
+         */
+        virtual void multiply(Value &result, const Value &a, const Value &b) const = 0;
+
+        /**
+         * Field squaring in the representation of the backend. The result may alias a.
+         * @param result The square.
+         * @param a The operand, lower than the modulus.
+         */
+        virtual void square(Value &result, const Value &a) const = 0;
+
+        /**
+         * Convert a plain value into the representation of the backend.
+         * @param a The plain value, which is reduced.
+         * @return The represented value, lower than the modulus.
+         */
+        virtual Value encode(const UnsignedBigInteger &a) const = 0;
+
+        /**
+         * Convert a represented value back to a plain value.
+         * @param a The represented value.
+         * @return The plain value, lower than the modulus.
+         */
+        virtual UnsignedBigInteger decode(const Value &a) const = 0;
+    };
+}
+
+#endif //INC_3A_ECC_CPP_FIELD_H
@@ -0,0 +1,188 @@
+#ifndef INC_3A_ECC_CPP_FIELDELEMENT_H
+#define INC_3A_ECC_CPP_FIELDELEMENT_H
+
+#include <span>
+#include "UnsignedBigInteger.h"
+#include "FixedUnsignedInteger.h"
+#include "Field.h"
+#include "Montgomery.h"
+
+namespace ecc {
+    /**
+     * Element of a prime field, kept in the representation of its field backend (e.g. the Montgomery domain,
+     * value = x * r mod modulus, or the plain value for the P-256 fast reduction).
+     * The backend is interned (see Montgomery::forModulus()) and shared between all the elements of the same field,
+     * so that its constants are computed once and copying an element does not touch a reference count. Values only
+     * leave the backend representation through toUnsigned().
+     * Values are stored on Field::FIELD_LIMBS inline digits, so that arithmetic does not allocate.
+     */
+    class FieldElement {
+    public:
+        typedef Field::Value Value;
+
+        /**
+         * The field backend, which must outlive the element.
+         */
+        const Field *context = nullptr;
+
+        /**
+         * The value in the representation of the backend.
+         */
+        Value value;
+
+
+        /**
+         * Default constructor. The element is zero and not bound to any field.
+         */
+        FieldElement() = default;
+
+
+        /**
+         * Construct from a plain value, which is reduced and converted into the representation of the backend.
+         * @param pValue The plain value.
+         * @param pContext The field backend.
+         */
+        FieldElement(const UnsignedBigInteger &pValue, const Field *pContext);
+
+
+        /**
+         * Build an element from a value which is already in the representation of the backend.
+         * @param pValue The represented value, lower than the modulus.
+         * @param pContext The field backend.
+         * @return The field element.
+         */
+        static FieldElement fromValue(const Value &pValue, const Field *pContext);
+
+
+        /**
+         * Convert the element back from the representation of the backend.
+         * @return The plain value, lower than the modulus.
+         */
+        UnsignedBigInteger toUnsigned() const;
+
+
+        /**
+         * @return true if the element is zero.
+         */
+        bool isZero() const {
+            return value.isZero();
+        }
+
+
+        bool operator==(const FieldElement &other) const {
+            return value == other.value;
+        }
+
+
+        bool operator!=(const FieldElement &other) const {
+            return !(other == *this);
+        }
+
+
+        /**
+         * Addition operator.
+         * @param other The other field element to add.
+         * @return The field element sum.
+         */
+        FieldElement operator+(const FieldElement &other) const;
+
+
+        /**
+         * Addition assignment operator.
+         * @param other The other field element to add.
+         * @return The field element sum reference.
+         */
+        FieldElement &operator+=(const FieldElement &other);
+
+
+        /**
+         * Subtraction operator.
+         * @param delta The other field element to subtract.
+         * @return The field element difference.
+         */
+        FieldElement operator-(const FieldElement &delta) const;
+
+
+        /**
+         * Subtraction assignment operator.
+         * @param delta The other field element to subtract.
+         * @return The field element difference reference.
+         */
+        FieldElement &operator-=(const FieldElement &delta);
+
+
+        /**
+         * Negation operator.
+         * @return The field element opposite.
+         */
+        FieldElement operator-() const;
+
+
+        /**
+         * Multiplication operator. The product stays in the backend representation.
+         * @param other The other field element to multiply.
+         * @return The field element product.
+         */
+        FieldElement operator*(const FieldElement &other) const;
+
+
+        /**
+         * Multiplication assignment operator. The product stays in the backend representation.
+         * @param other The other field element to multiply.
+         * @return The field element product reference.
+         */
+        FieldElement &operator*=(const FieldElement &other);
+
+
+        /**
+         * Squaring, cheaper than multiplying the element by itself. The square stays in the backend representation.
+         * @return The field element square.
+         */
+        FieldElement square() const;
+
+
+        /**
+         * Multiplicative inverse, in constant time (see Inversion::safegcd()). The element must not be zero.
+         * @return The field element inverse.
+         */
+        FieldElement inverse() const;
+
+
+        /**
+         * Square root, see Exponentiation::squareRoot(): the fixed chain for the P-256 prime, a^((p + 1) / 4) for the
+         * other primes p = 3 mod 4, Tonelli-Shanks otherwise.
+         * @return One of the two square roots (zero for zero).
+         * @throws std::domain_error If the element is not a square.
+         */
+        FieldElement sqrt() const;
+
+
+        /**
+         * Invert a batch of elements of the same field in place, with a single inversion and 3(N - 1) multiplications
+         * (Montgomery's trick). None of the elements may be zero.
+         * @param elements The elements to invert.
+         */
+        static void batchInvert(std::span<FieldElement> elements);
+
+
+        /**
+         * Exchange two elements of the same field if the condition is set, without branching on the condition.
+         * @param first The first element.
+         * @param second The second element.
+         * @param condition 1 to swap, 0 to keep both elements.
+         */
+        static void conditionalSwap(FieldElement &first, FieldElement &second, Digit condition) {
+            first.value.conditionalSwap(second.value, condition);
+        }
+
+
+        /**
+         * @return true if the element is one.
+         */
+        bool isOne() const {
+            return value == context->fixedOne;
+        }
+    };
+}
+
+#endif //INC_3A_ECC_CPP_FIELDELEMENT_H
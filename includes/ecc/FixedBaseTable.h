@@ -0,0 +1,92 @@
+#ifndef INC_3A_ECC_CPP_FIXEDBASETABLE_H
+#define INC_3A_ECC_CPP_FIXEDBASETABLE_H
+
+#include <istream>
+#include <ostream>
+#include <vector>
+#include "UnsignedBigInteger.h"
+#include "Point.h"
+#include "JacobianPoint.h"
+
+namespace ecc {
+    /**
+     * Fixed-base scalar multiplication engine. The scalar is split in windows of w bits, and every window has its
+     * multiples j * 2^(w * i) * base (j = 1 .. 2^w - 1) precomputed in affine coordinates. Multiplying the base by a
+     * scalar of up to "bits" bits then costs one mixed addition per non-zero window, and no doubling.
+     *
+     * The table may be saved to a stream and loaded back, so that it does not need to be recomputed at startup.
+     */
+    class FixedBaseTable {
+    public:
+        static const unsigned DEFAULT_WIDTH = 4;
+
+        /**
+         * The base point.
+         */
+        Point base;
+
+        /**
+         * The window width w.
+         */
+        unsigned width = DEFAULT_WIDTH;
+
+        /**
+         * The maximum scalar size in bits, larger scalars fall back to the variable-base multiplication.
+         */
+        size_t bits = 0;
+
+        /**
+         * The affine multiples, window after window: entries[i * (2^w - 1) + j - 1] = j * 2^(w * i) * base.
+         */
+        std::vector<JacobianPoint> entries;
+
+
+        /**
+         * Precompute the table.
+         * @param pBase The base point.
+         * @param pBits The maximum scalar size in bits (e.g. the bit length of the group order).
+         * @param pWidth The window width, between 1 and 8.
+         */
+        FixedBaseTable(const Point &pBase, size_t pBits, unsigned pWidth = DEFAULT_WIDTH);
+
+
+        /**
+         * Multiply the base point by a scalar.
+         * @param k The scalar.
+         * @return The point product.
+         */
+        Point multiply(const UnsignedBigInteger &k) const;
+
+
+        /**
+         * Multiply the base point by a secret scalar in constant time: every window reads all the entries of its row
+         * and keeps the right one with masks, and the entries are added with the complete formula, so that neither
+         * the memory accesses nor the branches depend on the scalar.
+         * @param k The scalar, lower than 2^bits.
+         * @return The point product.
+         */
+        Point multiplyConstantTime(const UnsignedBigInteger &k) const;
+
+
+        /**
+         * Write the table (header and hexadecimal affine coordinates) to a stream.
+         * @param outputStream The output stream.
+         */
+        void save(std::ostream &outputStream) const;
+
+
+        /**
+         * Read a table written by save(). Every entry is checked to be on the curve of the base point, then to be the
+         * right multiple of the base point, which costs one mixed addition per entry.
+         * @param inputStream The input stream.
+         * @param pBase The base point the table was computed for.
+         * @return The fixed-base table.
+         */
+        static FixedBaseTable load(std::istream &inputStream, const Point &pBase);
+
+    private:
+        FixedBaseTable() = default;
+    };
+}
+
+#endif //INC_3A_ECC_CPP_FIXEDBASETABLE_H
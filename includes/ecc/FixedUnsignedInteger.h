@@ -0,0 +1,262 @@
+#ifndef INC_3A_ECC_CPP_FIXEDUNSIGNEDINTEGER_H
+#define INC_3A_ECC_CPP_FIXEDUNSIGNEDINTEGER_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include "ECCTypes.h"
+#include "UnsignedBigInteger.h"
+
+using std::size_t;
+
+namespace ecc {
+    /**
+     * Fixed-width unsigned integers of N digits, stored inline (no heap allocation).
+     * Arithmetic is done modulo 2^(BITS * N), and the add/subtract methods report the outgoing carry/borrow so that
+     * callers can implement modular arithmetic on top of them. Leading zeros are kept, there is no trimming.
+     *
+     * @tparam N The number of digits (e.g. 256 / BITS for 256-bit integers).
+     */
+    template<size_t N>
+    class FixedUnsignedInteger {
+    public:
+        static const unsigned BITS = UnsignedBigInteger::BITS;
+
+        /**
+         * The digits, lowest-order first.
+         */
+        std::array<Digit, N> digits{};
+
+
+        /**
+         * Default constructor with a single digit. By default, if no args were given, it is initialized to zero.
+         * @param pDigit The lowest-order digit.
+         */
+        constexpr FixedUnsignedInteger(Digit pDigit = 0) {
+            digits[0] = pDigit;
+        }
+
+
+        /**
+         * Construct from an arbitrary-long unsigned integer.
+         * @param source The unsigned big integer, which must fit in N digits.
+         */
+        explicit FixedUnsignedInteger(const UnsignedBigInteger &source) {
+            if (source.digits.size() > N) {
+                throw std::overflow_error("Error: FixedUnsignedInteger: value does not fit");
+            }
+
+            std::copy(source.digits.begin(), source.digits.end(), digits.begin());
+        }
+
+
+        /**
+         * @return the arbitrary-long unsigned integer with the same value.
+         */
+        UnsignedBigInteger toUnsigned() const {
+            return UnsignedBigInteger(Digits(digits.begin(), digits.end()));
+        }
+
+
+        constexpr bool operator==(const FixedUnsignedInteger &other) const {
+            return digits == other.digits;
+        }
+
+
+        constexpr bool operator!=(const FixedUnsignedInteger &other) const {
+            return !(*this == other);
+        }
+
+
+        constexpr bool operator<(const FixedUnsignedInteger &other) const {
+            for (size_t j = N; j-- != 0;) {
+                if (digits[j] != other.digits[j]) {
+                    return digits[j] < other.digits[j];
+                }
+            }
+
+            return false;
+        }
+
+
+        constexpr bool operator>(const FixedUnsignedInteger &other) const {
+            return other < *this;
+        }
+
+
+        constexpr bool operator<=(const FixedUnsignedInteger &other) const {
+            return !(other < *this);
+        }
+
+
+        constexpr bool operator>=(const FixedUnsignedInteger &other) const {
+            return !(*this < other);
+        }
+
+
+        /**
+         * @return true if all the digits are zero.
+         */
+        constexpr bool isZero() const {
+            Digit accumulator = 0;
+            for (size_t j = 0; j < N; ++j) {
+                accumulator |= digits[j];
+            }
+
+            return accumulator == 0;
+        }
+
+
+        /**
+         * Get the nth bit of the integer.
+         * @param bitIndex The index of the desired bit.
+         * @return The bit value (0 or 1).
+         */
+        constexpr uint8_t getBit(size_t bitIndex) const {
+            return (digits[bitIndex / BITS] >> (bitIndex % BITS)) & 1;
+        }
+
+
+        /**
+         * Add another integer in place.
+         * @param other The other integer.
+         * @return The outgoing carry (0 or 1).
+         */
+        constexpr Digit add(const FixedUnsignedInteger &other) {
+            DoubleDigit carry = 0;
+
+            for (size_t j = 0; j < N; ++j) {
+                carry += static_cast<DoubleDigit>(digits[j]) + other.digits[j];
+                digits[j] = static_cast<Digit>(carry);
+                carry >>= BITS;
+            }
+
+            return static_cast<Digit>(carry);
+        }
+
+
+        /**
+         * Subtract another integer in place.
+         * @param delta The integer to subtract.
+         * @return The outgoing borrow (0 or 1).
+         */
+        constexpr Digit subtract(const FixedUnsignedInteger &delta) {
+            DoubleDigit borrow = 0;
+
+            for (size_t j = 0; j < N; ++j) {
+                borrow = static_cast<DoubleDigit>(digits[j]) - delta.digits[j] - borrow;
+                digits[j] = static_cast<Digit>(borrow);
+                borrow = (borrow >> BITS) & 1;
+            }
+
+            return static_cast<Digit>(borrow);
+        }
+
+
+        /**
+         * Replace the digits by the other ones if the condition is set, without branching on the condition.
+         * @param other The other integer.
+         * @param condition 1 to assign, 0 to keep the current value.
+         */
+        constexpr void conditionalAssign(const FixedUnsignedInteger &other, Digit condition) {
+            const Digit mask = -condition;
+
+            for (size_t j = 0; j < N; ++j) {
+                digits[j] = (other.digits[j] & mask) | (digits[j] & ~mask);
+            }
+        }
+
+
+        /**
+         * Exchange the digits with the other ones if the condition is set, without branching on the condition.
+         * @param other The other integer.
+         * @param condition 1 to swap, 0 to keep both values.
+         */
+        constexpr void conditionalSwap(FixedUnsignedInteger &other, Digit condition) {
+            const Digit mask = -condition;
+
+            for (size_t j = 0; j < N; ++j) {
+                const Digit delta = (digits[j] ^ other.digits[j]) & mask;
+                digits[j] ^= delta;
+                other.digits[j] ^= delta;
+            }
+        }
+
+
+        /**
+         * Addition operator, modulo 2^(BITS * N).
+         * @param other The other integer.
+         * @return The sum.
+         */
+        constexpr FixedUnsignedInteger operator+(const FixedUnsignedInteger &other) const {
+            FixedUnsignedInteger sum(*this);
+            sum.add(other);
+
+            return sum;
+        }
+
+
+        /**
+         * Addition assignment operator, modulo 2^(BITS * N).
+         * @param other The other integer.
+         * @return The sum reference.
+         */
+        constexpr FixedUnsignedInteger &operator+=(const FixedUnsignedInteger &other) {
+            add(other);
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction operator, modulo 2^(BITS * N).
+         * @param delta The integer to subtract.
+         * @return The difference.
+         */
+        constexpr FixedUnsignedInteger operator-(const FixedUnsignedInteger &delta) const {
+            FixedUnsignedInteger difference(*this);
+            difference.subtract(delta);
+
+            return difference;
+        }
+
+
+        /**
+         * Subtraction assignment operator, modulo 2^(BITS * N).
+         * @param delta The integer to subtract.
+         * @return The difference reference.
+         */
+        constexpr FixedUnsignedInteger &operator-=(const FixedUnsignedInteger &delta) {
+            subtract(delta);
+
+            return *this;
+        }
+
+
+        /**
+         * Full-width multiplication operator, the product never overflows.
+         * @param other The other integer.
+         * @return The product on N + M digits.
+         */
+        template<size_t M>
+        constexpr FixedUnsignedInteger<N + M> operator*(const FixedUnsignedInteger<M> &other) const {
+            FixedUnsignedInteger<N + M> product;
+
+            for (size_t i = 0; i < M; ++i) {
+                DoubleDigit carry = 0;
+
+                for (size_t j = 0; j < N; ++j) {
+                    carry += static_cast<DoubleDigit>(digits[j]) * other.digits[i] + product.digits[i + j];
+                    product.digits[i + j] = static_cast<Digit>(carry);
+                    carry >>= BITS;
+                }
+
+                product.digits[i + N] = static_cast<Digit>(carry);
+            }
+
+            return product;
+        }
+    };
+}
+
+#endif //INC_3A_ECC_CPP_FIXEDUNSIGNEDINTEGER_H
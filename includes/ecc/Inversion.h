@@ -0,0 +1,74 @@
+#ifndef INC_3A_ECC_CPP_INVERSION_H
+#define INC_3A_ECC_CPP_INVERSION_H
+
+#include "UnsignedBigInteger.h"
+#include "FixedUnsignedInteger.h"
+#include "Field.h"
+#include "FieldElement.h"
+
+namespace ecc {
+    /**
+     * Modular inversion engines for odd moduli, on fixed-width values (Field::FIELD_LIMBS digits), which do not
+     * allocate nor divide:
+     * - binary: the binary extended GCD, in variable time, for public values,
+     * - safegcd: Bernstein-Yang divsteps (safegcd), in constant time, for secret values; the divsteps are batched
+     *   30 at a time on machine words, which also makes it the fastest of the three,
+     * - fermatP256: a^(p - 2) with the fixed addition chain of the P-256 prime (see Exponentiation::p256Inverse), in
+     *   constant time.
+     *
+     * Non invertible values (zero, or not coprime with the modulus) throw std::domain_error.
+     */
+    class Inversion {
+    public:
+        typedef Field::Value Value;
+
+
+        /**
+         * Variable-time inversion with the binary extended GCD.
+         * @param a The value, lower than the modulus.
+         * @param modulus The odd modulus.
+         * @return a^-1 mod modulus.
+         */
+        static Value binary(const Value &a, const Value &modulus);
+
+
+        /**
+         * Variable-time inversion of big integers: the binary extended GCD when the modulus is odd and fits in
+         * Field::FIELD_LIMBS digits, the extended Euclid otherwise.
+         * @param a The integer, which is reduced.
+         * @param modulus The modulus.
+         * @return a^-1 mod modulus.
+         */
+        static UnsignedBigInteger binary(const UnsignedBigInteger &a, const UnsignedBigInteger &modulus);
+
+
+        /**
+         * Constant-time inversion with a fixed number of Bernstein-Yang divsteps, which only depends on the width of
+         * the values: the same operations are done for every input.
+         * @param a The value, lower than the modulus.
+         * @param modulus The odd modulus.
+         * @return a^-1 mod modulus.
+         */
+        static Value safegcd(const Value &a, const Value &modulus);
+
+
+        /**
+         * Constant-time inversion of big integers with safegcd.
+         * @param a The integer, lower than the modulus.
+         * @param modulus The odd modulus, which must fit in Field::FIELD_LIMBS digits.
+         * @return a^-1 mod modulus.
+         */
+        static UnsignedBigInteger safegcd(const UnsignedBigInteger &a, const UnsignedBigInteger &modulus);
+
+
+        /**
+         * Constant-time inversion in the P-256 field with Fermat's little theorem, a^-1 = a^(p - 2), through a fixed
+         * chain of 255 squarings and 12 multiplications.
+         * @param a The element, of a field of modulus p = 2^256 - 2^224 + 2^192 + 2^96 - 1.
+         * @return The element inverse.
+         */
+        static FieldElement fermatP256(const FieldElement &a);
+    };
+}
+
+#endif //INC_3A_ECC_CPP_INVERSION_H
@@ -0,0 +1,152 @@
+#ifndef INC_3A_ECC_CPP_JACOBIANPOINT_H
+#define INC_3A_ECC_CPP_JACOBIANPOINT_H
+
+#include <span>
+#include <vector>
+#include "UnsignedBigInteger.h"
+#include "Montgomery.h"
+#include "FieldElement.h"
+#include "Curve.h"
+#include "Point.h"
+
+namespace ecc {
+    /**
+     * Point of the elliptic curve y^2 = x^3 + ax + b, in Jacobian coordinates (x:y:z), representing the affine point
+     * (x/z^2, y/z^3). Doubling and addition are cheaper than with the homogeneous coordinates of Point, and the
+     * doubling uses the 3M+5S formula when a = -3 (which is the case of P-256).
+     */
+    class JacobianPoint {
+    public:
+        const Curve *curve = nullptr;
+        FieldElement x;
+        FieldElement y;
+        FieldElement z;
+        bool aIsMinusThree = false; // Copied from the curve, cleared to force the generic doubling
+
+        /**
+         * Default window width of the wNAF scalar multiplication: 2^(w-2) precomputed points, and about
+         * bits / (w + 1) additions.
+         */
+        static const unsigned WNAF_WIDTH = 5;
+
+        /**
+         * Number of terms from which the interleaved wNAF normalizes its tables with a single shared inversion, and
+         * then adds them with the mixed addition.
+         */
+        static const size_t AFFINE_TABLE_THRESHOLD = 8;
+
+        /**
+         * Default constructor. The point is the point at infinity, and is not bound to any curve.
+         */
+        JacobianPoint() = default;
+
+        /**
+         * Convert from homogeneous projective coordinates: (x:y:z) becomes (xz:yz^2:z), without inversion.
+         * @param point The homogeneous point.
+         */
+        explicit JacobianPoint(const Point &point);
+
+        /**
+         * Convert to homogeneous projective coordinates: (x:y:z) becomes (xz:y:z^3), without inversion.
+         * @return The homogeneous point.
+         */
+        Point toPoint() const;
+
+        JacobianPoint factory(const FieldElement &pX, const FieldElement &pY, const FieldElement &pZ) const;
+
+        /**
+         * Get the point at infinity (0:1:0) of a curve, bound to the curve field like Point::infinity().
+         * @param pCurve The curve, nullptr for the unbound point at infinity JacobianPoint().
+         * @return The point at infinity.
+         */
+        static JacobianPoint infinity(const Curve *pCurve);
+
+        bool isZero() const {
+            return z.isZero();
+        }
+
+        /**
+         * Point doubling, using "dbl-2001-b" (3M+5S) when a = -3 and "dbl-2007-bl" (1M+8S) otherwise.
+         * @return The doubled point.
+         */
+        JacobianPoint twice() const;
+
+        /**
+         * Point addition, using "add-2007-bl" (11M+5S).
+         * @param other The other point.
+         * @return The point sum reference.
+         */
+        JacobianPoint &operator+=(const JacobianPoint &other);
+
+        JacobianPoint operator+(const JacobianPoint &other) const;
+
+        /**
+         * Mixed addition with an affine point (z = 1), using "madd-2007-bl" (7M+4S). Precomputed tables normalized
+         * with normalize() should be added with it.
+         * @param other The other point, which must be normalized or at infinity.
+         * @return The point sum reference.
+         */
+        JacobianPoint &addAffine(const JacobianPoint &other);
+
+        /**
+         * Normalize the point to affine coordinates (x/z^2:y/z^3:1), which costs an inversion.
+         * @return The normalized point.
+         */
+        JacobianPoint normalize() const;
+
+        /**
+         * Normalize a batch of points to affine coordinates, so that they may be used with addAffine().
+         * A single inversion is shared by the whole batch (Montgomery's trick). Points at infinity are left untouched.
+         * @param points The points to normalize.
+         */
+        static void normalize(std::vector<JacobianPoint> &points);
+
+        /**
+         * Negation operator: (x:-y:z).
+         * @return The point opposite.
+         */
+        JacobianPoint operator-() const;
+
+        /**
+         * Scalar multiplication with the width-w non-adjacent form of the scalar. The odd multiples P, 3P, ...,
+         * (2^(w-1) - 1)P are precomputed, and negative digits add the opposite points.
+         * @param k The scalar.
+         * @param width The window width, between 2 and 8.
+         * @return The point product.
+         */
+        JacobianPoint multiply(const UnsignedBigInteger &k, unsigned width = WNAF_WIDTH) const;
+
+        /**
+         * Interleaved wNAF (Shamir's trick / Straus): sum of k_j P_j with one odd multiples table per point and a
+         * single doubling chain shared by all the terms. From AFFINE_TABLE_THRESHOLD terms, the tables are normalized
+         * together.
+         * @param points The points, on the same curve. The terms at infinity or with a zero scalar are skipped.
+         * @param scalars The scalars, as many as the points.
+         * @param width The window width, between 2 and 8.
+         * @return The sum of the products.
+         */
+        static JacobianPoint interleavedWnaf(
+                std::span<const JacobianPoint> points,
+                std::span<const UnsignedBigInteger> scalars,
+                unsigned width = WNAF_WIDTH
+        );
+
+        /**
+         * Pippenger's bucket method: the scalars are cut in c-bit signed windows, and for every window the points
+         * are first accumulated in the bucket of their digit, then the buckets are summed with running sums. The
+         * cost grows like n / log(n) additions per window, which is sub-linear in the number of terms. The points are
+         * normalized together first, so that the buckets are filled with mixed additions.
+         * @param points The points, on the same curve. The terms at infinity or with a zero scalar are skipped.
+         * @param scalars The scalars, as many as the points.
+         * @return The sum of the products.
+         */
+        static JacobianPoint pippenger(std::span<const JacobianPoint> points, std::span<const UnsignedBigInteger> scalars);
+
+        JacobianPoint operator*(const UnsignedBigInteger &other) const;
+
+        JacobianPoint &operator*=(const UnsignedBigInteger &other);
+    };
+}
+
+
+#endif //INC_3A_ECC_CPP_JACOBIANPOINT_H
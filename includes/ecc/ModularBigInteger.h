@@ -1,6 +1,7 @@
 #ifndef INC_3A_ECC_CPP_MODULARBIGINTEGER_H
 #define INC_3A_ECC_CPP_MODULARBIGINTEGER_H
 
+#include <span>
 #include "ECCTypes.h"
 #include "UnsignedBigInteger.h"
 #include "SignedBigInteger.h"
@@ -9,10 +10,7 @@ namespace ecc {
     class ModularBigInteger {
     public:
         UnsignedBigInteger value;
-        UnsignedBigInteger modulus;
-        UnsignedBigInteger r;
-        UnsignedBigInteger invR;
-        UnsignedBigInteger invModulus;
+        UnsignedBigInteger modulus; // The Montgomery constants live in a per-thread cache of contexts
 
         ModularBigInteger() : value(0), modulus(1) {}
 
@@ -106,6 +104,40 @@ namespace ecc {
          */
         ModularBigInteger &operator*=(const ModularBigInteger &other);
 
+
+        /**
+         * Squaring, cheaper than multiplying the modular big integer by itself.
+         * @return The modular big integer square.
+         */
+        ModularBigInteger square() const;
+
+
+        /**
+         * Exponentiation with sliding windows in the Montgomery domain, see Montgomery::pow(), or with plain
+         * reductions when the modulus is even. The time depends on the exponent, which must be public.
+         * @param exponent The exponent.
+         * @return The modular big integer power.
+         */
+        ModularBigInteger pow(const UnsignedBigInteger &exponent) const;
+
+
+        /**
+         * Square root modulo an odd prime, see FieldElement::sqrt(). The modulus must fit in Field::FIELD_LIMBS
+         * digits.
+         * @return One of the two modular square roots.
+         * @throws std::domain_error If the integer is not a square.
+         * @throws std::invalid_argument If the modulus is even.
+         */
+        ModularBigInteger sqrt() const;
+
+
+        /**
+         * Invert a batch of integers sharing the same modulus in place, with a single inversion and 3(N - 1)
+         * modular multiplications (Montgomery's trick).
+         * @param values The integers to invert, which must all be invertible.
+         */
+        static void batchInvert(std::span<ModularBigInteger> values);
+
     private:
 
         /**
@@ -6,30 +6,156 @@
 #define INC_3A_ECC_CPP_MONTGOMERY_H
 
 #include "UnsignedBigInteger.h"
+#include "FixedUnsignedInteger.h"
+#include "Field.h"
 
 namespace ecc {
-    class Montgomery {
+    /**
+     * Montgomery arithmetic for any odd modulus, with the reducer r = 2^(BITS * limbs). As a field backend, elements
+     * are kept in the Montgomery domain (a * r mod modulus).
+     */
+    class Montgomery : public Field {
     public:
-        UnsignedBigInteger modulus;
         size_t reducerBits;
         UnsignedBigInteger r;
         UnsignedBigInteger invR;
-        UnsignedBigInteger invN;
+        Digit invN; // -modulus^-1 mod 2^BITS, the only inverse needed by the word-level reduction
         UnsignedBigInteger r2modN;
 
         Montgomery(const UnsignedBigInteger &pModulus);
 
+        /**
+         * Get the interned context of a modulus: contexts are built once per modulus and never released, so that
+         * values may point to them without reference counting. Interning is meant for long-lived moduli (the fields
+         * of the curves, the group orders), ad-hoc moduli should own their context instead.
+         * @param pModulus The odd modulus.
+         * @return The shared context.
+         */
+        static const Montgomery *forModulus(const UnsignedBigInteger &pModulus);
+
+        void multiply(Value &result, const Value &a, const Value &b) const override;
+
+        void square(Value &result, const Value &a) const override;
+
+        Value encode(const UnsignedBigInteger &a) const override;
+
+        UnsignedBigInteger decode(const Value &a) const override;
+
         UnsignedBigInteger montgomeryRef(const UnsignedBigInteger &a, const UnsignedBigInteger &b) const;
 
         UnsignedBigInteger montgomery(const UnsignedBigInteger &a, const UnsignedBigInteger &b) const;
 
-        UnsignedBigInteger modR(const UnsignedBigInteger &in) const;
+        /**
+         * Three-address Montgomery multiplication, out = a * b * r^-1 mod modulus. The operands are padded into the
+         * caller's scratch and the product is written in the digits of out, so that nothing is allocated once both
+         * are large enough (3 * limbs + 2 and limbs digits). out may alias a or b.
+         * @param out The product.
+         * @param a The first operand, at most limbs digits long (it is reduced otherwise, which allocates).
+         * @param b The second operand, same as a.
+         * @param scratch A scratch buffer, grown as needed.
+         */
+        void montgomery(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b,
+                        Digits &scratch) const;
+
+        /**
+         * Word-level Montgomery multiplication (Coarsely Integrated Operand Scanning), computing
+         * result = a * b * r^-1 mod modulus on fixed-size little-endian digit buffers. The multiplication and the
+         * reduction are interleaved digit per digit, so that no temporary bigger than limbs + 2 digits is needed and
+         * the final subtraction is done without branching.
+         * The result buffer may alias a or b. Inputs must verify a * b < modulus * r.
+         * @param result The product buffer (limbs digits).
+         * @param a The first operand buffer (limbs digits).
+         * @param b The second operand buffer (limbs digits).
+         * @param modulus The modulus buffer (limbs digits).
+         * @param invN The single digit -modulus^-1 mod 2^BITS.
+         * @param limbs The number of digits of the buffers.
+         * @param scratch A scratch buffer of at least limbs + 2 digits.
+         */
+        static void multiply(
+                Digit *result,
+                const Digit *a,
+                const Digit *b,
+                const Digit *modulus,
+                Digit invN,
+                size_t limbs,
+                Digit *scratch
+        );
 
-        UnsignedBigInteger divR(const UnsignedBigInteger &in) const;
+        /**
+         * Word-level Montgomery squaring, computing result = a * a * r^-1 mod modulus. The cross products a[i]*a[j]
+         * are computed once and doubled, then the double-size square is reduced digit per digit (Separated Operand
+         * Scanning). The result buffer may alias a.
+         * @param result The square buffer (limbs digits).
+         * @param a The operand buffer (limbs digits), lower than the modulus.
+         * @param modulus The modulus buffer (limbs digits).
+         * @param invN The single digit -modulus^-1 mod 2^BITS.
+         * @param limbs The number of digits of the buffers.
+         * @param scratch A scratch buffer of at least 2 * limbs digits.
+         */
+        static void square(
+                Digit *result,
+                const Digit *a,
+                const Digit *modulus,
+                Digit invN,
+                size_t limbs,
+                Digit *scratch
+        );
+
+        /**
+         * Montgomery squaring on big integers, see square().
+         * @param a The operand, lower than the modulus.
+         * @return a * a * r^-1 mod modulus.
+         */
+        UnsignedBigInteger montgomerySquare(const UnsignedBigInteger &a) const;
 
         static UnsignedBigInteger knuthModularInverse(const UnsignedBigInteger &in, const UnsignedBigInteger &mod);
 
         UnsignedBigInteger multiplication(const UnsignedBigInteger &a, const UnsignedBigInteger &b) const;
+
+        /**
+         * Three-address modular multiplication of plain values, out = a * b mod modulus, through two Montgomery
+         * multiplications (the second one by r^2 cancels both factors r^-1). Like montgomery(), it does not allocate
+         * once out and scratch are large enough, as long as the operands are lower than the modulus.
+         * @param out The product.
+         * @param a The first operand (it is reduced when greater than the modulus, which allocates).
+         * @param b The second operand, same as a.
+         * @param scratch A scratch buffer, grown as needed.
+         */
+        void multiplication(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b,
+                            Digits &scratch) const;
+
+        /**
+         * Convert a value into the Montgomery domain (a * r mod modulus).
+         * @param a The plain value.
+         * @return The Montgomery domain value.
+         */
+        UnsignedBigInteger toMontgomery(const UnsignedBigInteger &a) const;
+
+        /**
+         * Convert a value back from the Montgomery domain (a * r^-1 mod modulus).
+         * @param a The Montgomery domain value.
+         * @return The plain value.
+         */
+        UnsignedBigInteger fromMontgomery(const UnsignedBigInteger &a) const;
+
+        /**
+         * Modular exponentiation with sliding windows, on a Montgomery domain accumulator: on fixed-width field
+         * elements when the modulus fits in Field::FIELD_LIMBS digits, on big integers otherwise. The time depends on
+         * the exponent, which must be public.
+         * @param base The base, which is reduced.
+         * @param exponent The exponent.
+         * @return base^exponent mod modulus.
+         */
+        UnsignedBigInteger pow(const UnsignedBigInteger &base, const UnsignedBigInteger &exponent) const;
+
+        /**
+         * Constant-time modular exponentiation with fixed windows, see Exponentiation::fixedWindow(). The exponent is
+         * always read on reducerBits bits.
+         * @param base The base, which is reduced.
+         * @param exponent The secret exponent, lower than r.
+         * @return base^exponent mod modulus.
+         */
+        UnsignedBigInteger powConstantTime(const UnsignedBigInteger &base, const UnsignedBigInteger &exponent) const;
     };
 }
 
@@ -5,31 +5,47 @@
 #ifndef INC_3A_ECC_CPP_P256_H
 #define INC_3A_ECC_CPP_P256_H
 
+#include <memory>
 #include "UnsignedBigInteger.h"
 #include "ModularBigInteger.h"
+#include "Montgomery.h"
+#include "Field.h"
+#include "P256Field.h"
 #include "Point.h"
+#include "FixedBaseTable.h"
 
 namespace ecc {
     class P256 {
     public:
         static UnsignedBigInteger m;
+        static UnsignedBigInteger n;
+        static const Field *context; // The NIST fast reduction backend
         static ModularBigInteger a;
         static ModularBigInteger b;
         static Point generator;
-    };
 
-    std::string mod = "115792089210356248762697446949407573530086143415290314195533631308867097853951";
-    UnsignedBigInteger P256::m(mod);
-    ModularBigInteger P256::a("3", mod);
-    ModularBigInteger P256::b("41058363725152142129326129780047268409114441015993725554835256314039467401291", mod);
-    Point P256::generator(
-            UnsignedBigInteger("48439561293906451759052585252797914202762949526041747995844080717082404635286"),
-            UnsignedBigInteger("2258390684796862237411570494974242622288194167061563441992324890848025900319"),
-            UnsignedBigInteger("1"),
-            P256::a.value,
-            P256::b.value,
-            mod
-    );
+
+        /**
+         * Get the fixed-base table of the generator, which is computed on the first call unless it was set before.
+         * @return The generator table.
+         */
+        static std::shared_ptr<const FixedBaseTable> generatorTable();
+
+
+        /**
+         * Replace the generator table, e.g. with a table loaded with FixedBaseTable::load().
+         * @param table The generator table.
+         */
+        static void setGeneratorTable(std::shared_ptr<const FixedBaseTable> table);
+
+
+        /**
+         * Multiply the generator by a scalar with the fixed-base table (no doubling).
+         * @param k The scalar.
+         * @return The point k * generator.
+         */
+        static Point multiplyGenerator(const UnsignedBigInteger &k);
+    };
 }
 
 
@@ -0,0 +1,42 @@
+#ifndef INC_3A_ECC_CPP_P256FIELD_H
+#define INC_3A_ECC_CPP_P256FIELD_H
+
+#include "UnsignedBigInteger.h"
+#include "FixedUnsignedInteger.h"
+#include "Field.h"
+
+namespace ecc {
+    /**
+     * Field backend specialized for the P-256 prime p = 2^256 - 2^224 + 2^192 + 2^96 - 1, with the NIST fast
+     * reduction (FIPS 186-4, D.2.3): the 512-bit product is reduced by adding and subtracting shuffles of its 32-bit
+     * words, without any division nor Montgomery reduction. Elements are kept as plain values.
+     */
+    class P256Field : public Field {
+    public:
+        /**
+         * Get the shared backend.
+         * @return The P-256 field backend.
+         */
+        static const P256Field *instance();
+
+        void multiply(Value &result, const Value &a, const Value &b) const override;
+
+        void square(Value &result, const Value &a) const override;
+
+        Value encode(const UnsignedBigInteger &a) const override;
+
+        UnsignedBigInteger decode(const Value &a) const override;
+
+        /**
+         * Reduce a product modulo p, without branching on the value.
+         * @param product The product, lower than p^2.
+         * @return The reduced value.
+         */
+        Value reduce(const FixedUnsignedInteger<2 * FIELD_LIMBS> &product) const;
+
+    private:
+        P256Field();
+    };
+}
+
+#endif //INC_3A_ECC_CPP_P256FIELD_H
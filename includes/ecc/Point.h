@@ -2,29 +2,67 @@
 #ifndef INC_3A_ECC_CPP_POINT_H
 #define INC_3A_ECC_CPP_POINT_H
 
+#include <span>
+#include <vector>
 #include "UnsignedBigInteger.h"
-#include "ModularBigInteger.h"
+#include "Montgomery.h"
+#include "FieldElement.h"
+#include "Curve.h"
 
 namespace ecc {
+    /**
+     * Point of the elliptic curve y^2 = x^3 + ax + b, in homogeneous projective coordinates (x:y:z).
+     * All coordinates and curve parameters are field elements sharing the same Montgomery context, so that they stay
+     * in the Montgomery domain along the point formulas. The curve parameters are held by the interned curve.
+     */
     class Point {
     public:
-        UnsignedBigInteger m;
-        ModularBigInteger x;
-        ModularBigInteger y;
-        ModularBigInteger z;
-        ModularBigInteger a;
-        ModularBigInteger b;
+        static const size_t PIPPENGER_THRESHOLD = 128;
+
+        const Curve *curve = nullptr;
+        FieldElement x;
+        FieldElement y;
+        FieldElement z;
+
+        /**
+         * Default constructor. The point is the point at infinity, and is not bound to any curve.
+         */
+        Point() = default;
+
+        Point(
+                const UnsignedBigInteger &pX,
+                const UnsignedBigInteger &pY,
+                const UnsignedBigInteger &pZ,
+                const UnsignedBigInteger &pA,
+                const UnsignedBigInteger &pB,
+                const UnsignedBigInteger &pM
+        );
 
         Point(
-                const UnsignedBigInteger &pX = 0,
-                const UnsignedBigInteger &pY = 0,
-                const UnsignedBigInteger &pZ = 0,
-                const UnsignedBigInteger &pA = 0,
-                const UnsignedBigInteger &pB = 0,
-                const UnsignedBigInteger &pM = 1
+                const UnsignedBigInteger &pX,
+                const UnsignedBigInteger &pY,
+                const UnsignedBigInteger &pZ,
+                const UnsignedBigInteger &pA,
+                const UnsignedBigInteger &pB,
+                const Field *pField
         );
 
-        Point factory(const ModularBigInteger &pX, const ModularBigInteger &pY, const ModularBigInteger &pZ) const;
+        Point(
+                const UnsignedBigInteger &pX,
+                const UnsignedBigInteger &pY,
+                const UnsignedBigInteger &pZ,
+                const Curve *pCurve
+        );
+
+        Point factory(const FieldElement &pX, const FieldElement &pY, const FieldElement &pZ) const;
+
+        /**
+         * Get the point at infinity (0:1:0) of a curve, whose coordinates are bound to the curve field so that it
+         * may go through any point formula.
+         * @param pCurve The curve, nullptr for the unbound point at infinity Point().
+         * @return The point at infinity.
+         */
+        static Point infinity(const Curve *pCurve);
 
         bool isZero() const;
 
@@ -49,6 +87,102 @@ namespace ecc {
         Point operator*(const UnsignedBigInteger &other) const;
 
         Point &operator*=(const UnsignedBigInteger &other);
+
+        /**
+         * Multi-scalar multiplication, the sum of scalars[j] * points[j]. Up to PIPPENGER_THRESHOLD terms, Shamir's
+         * trick shares a single doubling chain between the terms (interleaved wNAF), from there on Pippenger's bucket
+         * method is used. The terms at infinity or with a zero scalar are skipped.
+         * @param points The points, on the same curve.
+         * @param scalars The scalars, as many as the points.
+         * @return The sum of the products (the unbound point at infinity if there is no term).
+         */
+        static Point multiScalarMul(std::span<const Point> points, std::span<const UnsignedBigInteger> scalars);
+
+        /**
+         * Complete addition (Renes, Costello and Batina 2016, algorithm 1, 12M+3m_a+2m_3b): the same formula is used
+         * for any pair of points, including doublings, opposite points and the point at infinity, so that it does
+         * not branch on the coordinates. The points at infinity are first brought to the (0:1:0) form of the
+         * formulas with masked assignments, and the unbound Point() takes the curve of the other operand.
+         * @param other The other point, on the same curve.
+         * @return The point sum.
+         */
+        Point completeAdd(const Point &other) const;
+
+        /**
+         * Constant-time scalar multiplication: a Montgomery ladder over all the Field::FIELD_LIMBS * BITS scalar bits,
+         * with conditional swaps and complete additions, so that neither the branches nor the memory accesses depend
+         * on the scalar. It is slower than operator*, which should only be used with public scalars. The point itself
+         * is public: at infinity, the point at infinity is returned right away.
+         * @param k The scalar, lower than 2^(Field::FIELD_LIMBS * BITS).
+         * @return The point product.
+         */
+        Point ladder(const UnsignedBigInteger &k) const;
+
+        /**
+         * Exchange two points of the same curve if the condition is set, without branching on the condition.
+         * @param first The first point.
+         * @param second The second point.
+         * @param condition 1 to swap, 0 to keep both points.
+         */
+        static void conditionalSwap(Point &first, Point &second, Digit condition);
+
+        /**
+         * Normalize the point to affine coordinates (x/z:y/z:1), which costs an inversion.
+         * @return The normalized point.
+         */
+        Point normalize() const;
+
+        /**
+         * Normalize a batch of points to affine coordinates, so that they may be used with mixed additions.
+         * Points at infinity are left untouched.
+         * @param points The points to normalize.
+         */
+        static void normalize(std::vector<Point> &points);
+
+        /**
+         * Get the size of the SEC1 encodings of the points of a curve, other than the point at infinity.
+         * @param pCurve The curve.
+         * @param compressed true for the compressed form, false for the uncompressed one.
+         * @return 1 + L bytes compressed, 1 + 2L bytes uncompressed, L being the byte length of the field prime.
+         */
+        static size_t encodedSize(const Curve *pCurve, bool compressed);
+
+        /**
+         * Encode the point in a SEC1 (X9.62) form, into a buffer of the caller: 0x04 || x || y uncompressed, 0x02 or
+         * 0x03 after the parity of y, followed by x, compressed. The coordinates are big-endian on as many bytes as
+         * the field prime, and the point at infinity is the single byte 0x00. Costs an inversion to normalize the
+         * point.
+         * @param output The output bytes, at least encodedSize(curve, compressed) long.
+         * @param compressed true for the compressed form, false for the uncompressed one.
+         * @return The number of bytes written.
+         */
+        size_t encode(std::span<uint8_t> output, bool compressed) const;
+
+        /**
+         * Encode the point in the SEC1 compressed form, see encode().
+         * @return The compressed encoding.
+         */
+        std::vector<uint8_t> compress() const;
+
+        /**
+         * Decode a point in the SEC1 compressed form, y being recovered as the square root of x^3 + ax + b of the
+         * encoded parity (see FieldElement::sqrt()).
+         * @param encoded The compressed encoding.
+         * @param pCurve The curve of the point.
+         * @return The point, with z = 1, or the point at infinity.
+         * @throws std::invalid_argument If the encoding is malformed, or x is not the abscissa of a point of the curve.
+         */
+        static Point decompress(std::span<const uint8_t> encoded, const Curve *pCurve);
+
+        /**
+         * Decode a point in any SEC1 form: uncompressed, compressed (see decompress()) or the point at infinity.
+         * The coordinates must be reduced, and the point must be on the curve.
+         * @param encoded The encoding.
+         * @param pCurve The curve of the point.
+         * @return The point, with z = 1, or the point at infinity.
+         * @throws std::invalid_argument If the encoding is malformed, or the point is not on the curve.
+         */
+        static Point decode(std::span<const uint8_t> encoded, const Curve *pCurve);
     };
 }
 
@@ -16,9 +16,9 @@ namespace ecc {
 
 
         /**
-         * Default constructor with a single unsigned 32-bits digit. By default, if no args were given, it is initialized to
+         * Default constructor with a single unsigned digit. By default, if no args were given, it is initialized to
          * zero.
-         * @param pDigit The 32-bits digit.
+         * @param pDigit The digit.
          */
         SignedBigInteger(Digit pDigit = 0);
 
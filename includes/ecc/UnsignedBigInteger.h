@@ -5,8 +5,10 @@
 #include <cctype>
 #include <cstdint>
 #include <iostream>
+#include <span>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include "ECCTypes.h"
@@ -23,26 +25,46 @@ namespace ecc {
      */
     class UnsignedBigInteger {
     public:
-        static const unsigned BITS = 32;
+        static const unsigned BITS = sizeof(Digit) * 8;
 
         /**
-         * The unsigned big integer digits. Each is a 32-bits unsigned integer and may support up to 2^32 values.
+         * Operand sizes (in digits) from which the multiplication and the squaring switch from the schoolbook method
+         * to Karatsuba, and then to Toom-3. See benchmarks/ecc/UnsignedBigIntegerBenchmark.cpp for their tuning.
+         */
+        static const size_t KARATSUBA_THRESHOLD = 48;
+        static const size_t TOOM3_THRESHOLD = 256;
+        static const size_t KARATSUBA_SQUARE_THRESHOLD = 96;
+        static const size_t TOOM3_SQUARE_THRESHOLD = 1024;
+
+        /**
+         * Decimal conversions work on chunks of DECIMAL_CHUNK_DIGITS decimal digits (the largest power of ten that fits
+         * in a digit), with single-digit multiply-adds and short divisions. Above the split thresholds (in decimal
+         * digits), the numbers are split in halves around the powers 10^(DECIMAL_CHUNK_DIGITS * 2^i), recursively.
+         * Chunk multiply-adds are cheaper than short divisions, hence the higher parsing threshold. See
+         * benchmarks/ecc/ConversionBenchmark.cpp for the tuning.
+         */
+        static const size_t DECIMAL_CHUNK_DIGITS = BITS == 64 ? 19 : 9;
+        static const size_t DECIMAL_PARSE_SPLIT_THRESHOLD = 3000;
+        static const size_t DECIMAL_PRINT_SPLIT_THRESHOLD = 1000;
+
+        /**
+         * The unsigned big integer digits. Each is a BITS-bits unsigned integer and may support up to 2^BITS values.
          * Thus, the size of `digits` is optimized. The first "digit" is the lowest-order bits.
          */
         Digits digits;
 
 
         /**
-         * Default constructor with a single 32-bits digit. By default, if no args were given, it is initialized to
+         * Default constructor with a single digit. By default, if no args were given, it is initialized to
          * zero.
-         * @param digit The 32-bits digit.
+         * @param digit The digit.
          */
         UnsignedBigInteger(Digit pDigit = 0);
 
 
         /**
          * Construct from an existing vector.
-         * @param pDigits The 32-bit digits vector.
+         * @param pDigits The digits vector.
          */
         UnsignedBigInteger(Digits pDigits);
 
@@ -63,6 +85,14 @@ namespace ecc {
         UnsignedBigInteger(const UnsignedBigInteger &copy) = default;
 
 
+        /**
+         * Move constructor, which takes over the digits buffer instead of allocating a copy. The moved-from instance
+         * may only be assigned or destroyed.
+         * @param other The moved instance.
+         */
+        UnsignedBigInteger(UnsignedBigInteger &&other) noexcept = default;
+
+
         /**
          * Assignment operator. Basically copies the instance digits from the other reference.
          * @param other The other reference.
@@ -72,8 +102,16 @@ namespace ecc {
 
 
         /**
-         * Assignment from a unsigned 32-bit integer, which allow easier initialization.
-         * @param str The unsigned 32-bit integer.
+         * Move assignment operator, see the move constructor.
+         * @param other The moved instance.
+         * @return this
+         */
+        UnsignedBigInteger &operator=(UnsignedBigInteger &&other) noexcept = default;
+
+
+        /**
+         * Assignment from a single digit, which allow easier initialization.
+         * @param str The digit.
          * @return this
          */
         UnsignedBigInteger &operator=(Digit pDigit);
@@ -332,7 +370,7 @@ namespace ecc {
 
 
         /**
-         * Extraction operator. For now, only base 10 digit strings are supported.
+         * Extraction operator. For now, only base 10 digit strings are supported, see fromDecimal().
          * @param inputStream The input stream.
          * @param result The parsed big integer.
          * @return The input stream.
@@ -351,7 +389,7 @@ namespace ecc {
 
         /**
          * Get the most significant bit of the Modular Big Integer
-         * @return
+         * @return The number of significant bits (0 for zero).
          */
         size_t getMostSignificantBitIndex() const;
 
@@ -359,18 +397,179 @@ namespace ecc {
         /**
          * Get the nth bit of the representation of the big integer.
          * @param bitIndex The index of the desired bit.
-         * @return
+         * @return The bit value (0 or 1), bits past the most significant digit are zeros.
+         */
+        uint8_t getBit(size_t bitIndex) const;
+
+
+        /**
+         * Get the width-w non-adjacent form (wNAF) of the integer: odd signed digits lower than 2^(w-1) in absolute
+         * value, any w consecutive digits having at most one non-zero digit. The windows are read directly from the
+         * digits, the integer is left untouched.
+         * @param width The window width w, between 2 and 8.
+         * @return The signed digits, lowest-order first, without leading zeros.
+         */
+        std::vector<int8_t> getNonAdjacentForm(unsigned width) const;
+
+
+        /**
+         * Parse a base 10 string. The chunks are merged with the fast multiplications above
+         * DECIMAL_PARSE_SPLIT_THRESHOLD digits, which makes the parsing subquadratic.
+         * @param decimal The decimal characters, most significant first.
+         * @return The unsigned big integer.
          */
-        uint8_t getBit(size_t bitIndex);
+        static UnsignedBigInteger fromDecimal(std::string_view decimal);
 
 
         /**
+         * Get the base 10 representation. Above DECIMAL_PRINT_SPLIT_THRESHOLD digits the number is split with
+         * balanced divisions by powers of ten, instead of one short division of the whole number per chunk.
          * @return the string representation of the number in base 10.
          */
         std::string to_string() const;
 
 
-    protected:
+        /**
+         * Import a big-endian unsigned byte string.
+         * @param bytes The bytes, most significant first.
+         * @return The unsigned big integer.
+         */
+        static UnsignedBigInteger fromBytes(std::span<const uint8_t> bytes);
+
+
+        /**
+         * Export the integer as a fixed-length big-endian byte string, left-padded with zeros.
+         * @param output The output bytes, most significant first.
+         */
+        void toBytes(std::span<uint8_t> output) const;
+
+
+        /**
+         * Import a big-endian hexadecimal string (without prefix, in any case), in linear time: every character is
+         * a nibble placed directly in its digit.
+         * @param hex The hexadecimal characters, most significant first.
+         * @return The unsigned big integer.
+         */
+        static UnsignedBigInteger fromHex(std::string_view hex);
+
+
+        /**
+         * Export the integer as a fixed-length big-endian lowercase hexadecimal string, left-padded with zeros.
+         * @param output The output characters, most significant first.
+         */
+        void toHex(std::span<char> output) const;
+
+
+        /**
+         * @return The shortest lowercase hexadecimal representation of the number ("0" for zero).
+         */
+        std::string toHex() const;
+
+
+        /**
+         * Square the big integer. The cross products a[i]*a[j] are only computed once, and the method switches to
+         * Karatsuba and Toom-3 squaring for large operands.
+         * @return The square of the big integer.
+         */
+        UnsignedBigInteger square() const;
+
+
+        /**
+         * Three-address addition, out = a + b. The digits of out are reused, so that no allocation happens once its
+         * capacity is large enough. out may alias a or b.
+         * @param out The sum.
+         * @param a A big integer.
+         * @param b Another big integer.
+         */
+        static void add(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b);
+
+
+        /**
+         * Three-address subtraction, out = a - b, which reuses the digits of out like add(). out may alias a or b.
+         * @param out The difference.
+         * @param a The source.
+         * @param b The delta, not greater than a.
+         */
+        static void subtract(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b);
+
+
+        /**
+         * Three-address schoolbook multiplication, out = a * b. The product is accumulated in the caller's scratch,
+         * which is then swapped with the digits of out: out may alias a or b, and once both buffers are large enough
+         * (they end up holding aSize + bSize digits) hot loops no longer allocate. From KARATSUBA_THRESHOLD, the
+         * multiplication operator is used instead, which allocates its temporaries.
+         * @param out The product.
+         * @param a A big integer.
+         * @param b Another big integer.
+         * @param scratch A scratch buffer, grown as needed.
+         */
+        static void multiply(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b,
+                             Digits &scratch);
+
+
+        /**
+         * Three-address schoolbook squaring, out = a * a, see multiply(). From KARATSUBA_SQUARE_THRESHOLD, square() is
+         * used instead.
+         * @param out The square.
+         * @param a A big integer.
+         * @param scratch A scratch buffer, grown as needed.
+         */
+        static void square(UnsignedBigInteger &out, const UnsignedBigInteger &a, Digits &scratch);
+
+
+        /**
+         * Schoolbook multiplication, in O(n*m). The multiplication operator uses it below KARATSUBA_THRESHOLD.
+         * @param a A big integer.
+         * @param b Another big integer.
+         * @return The product of a by b.
+         */
+        static UnsignedBigInteger schoolbookMultiply(const UnsignedBigInteger &a, const UnsignedBigInteger &b);
+
+
+        /**
+         * One level of Karatsuba multiplication (3 half-size products), the sub-products use the multiplication
+         * operator.
+         * @param a A big integer.
+         * @param b Another big integer.
+         * @return The product of a by b.
+         */
+        static UnsignedBigInteger karatsubaMultiply(const UnsignedBigInteger &a, const UnsignedBigInteger &b);
+
+
+        /**
+         * One level of Toom-3 multiplication (5 third-size products, evaluated at 0, 1, -1, -2 and infinity), the
+         * sub-products use the multiplication operator.
+         * @param a A big integer.
+         * @param b Another big integer.
+         * @return The product of a by b.
+         */
+        static UnsignedBigInteger toom3Multiply(const UnsignedBigInteger &a, const UnsignedBigInteger &b);
+
+
+        /**
+         * Schoolbook squaring, computing each cross product once and doubling it.
+         * @param a A big integer.
+         * @return The square of a.
+         */
+        static UnsignedBigInteger schoolbookSquare(const UnsignedBigInteger &a);
+
+
+        /**
+         * One level of Karatsuba squaring (3 half-size squares).
+         * @param a A big integer.
+         * @return The square of a.
+         */
+        static UnsignedBigInteger karatsubaSquare(const UnsignedBigInteger &a);
+
+
+        /**
+         * One level of Toom-3 squaring (5 third-size squares).
+         * @param a A big integer.
+         * @return The square of a.
+         */
+        static UnsignedBigInteger toom3Square(const UnsignedBigInteger &a);
+
+
         /**
          * Divide a big integer, and assign the quotient and the reminder to their respective references.
          * @param divider The divider.
@@ -382,8 +581,19 @@ namespace ecc {
 
         /**
          * Drop leading zeros of the digits (e.g. remove the digits equal to zeros, starting from the back of the vector).
+         * Public for the code which writes the digits in place, like the three-address Montgomery multiplication.
          */
         void trim();
+
+
+    protected:
+        /**
+         * Extract a range of digits.
+         * @param from The index of the first digit.
+         * @param count The maximum number of digits.
+         * @return The big integer made of the digits [from, from + count).
+         */
+        UnsignedBigInteger slice(size_t from, size_t count) const;
     };
 }
 #endif //INC_3A_ECC_CPP_UNSIGNEDBIGINTEGER_H
\ No newline at end of file
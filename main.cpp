@@ -10,17 +10,13 @@ int main(int argc, char *argv[]) {
     ModularBigInteger a = ModularBigInteger("12", "23");
     ModularBigInteger b = ModularBigInteger("123", "23");
     SignedBigInteger x, y;
-    ModularBigInteger::euclidian(
-            static_cast<UnsignedBigInteger>(a),
-            static_cast<UnsignedBigInteger>(b),
-            x,
-            y
-    );
+    SignedBigInteger gcd = SignedBigInteger::euclidean(a.value, b.value, x, y);
 
-    std::cout << a << std::endl
-              << b << std::endl
+    std::cout << a.value << std::endl
+              << b.value << std::endl
+              << gcd << std::endl
               << x << std::endl
               << y << std::endl;
 
     return 0;
-}
\ No newline at end of file
+}
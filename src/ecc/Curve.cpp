@@ -0,0 +1,43 @@
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include "../../includes/ecc/Curve.h"
+
+using namespace ecc;
+
+
+Curve::Curve(const UnsignedBigInteger &pA, const UnsignedBigInteger &pB, const Field *pField) {
+    field = pField;
+    a = FieldElement(pA, field);
+    b = FieldElement(pB, field);
+    b3 = b + b + b;
+    aIsMinusThree = (a + FieldElement(3, field)).isZero();
+}
+
+
+const Curve *Curve::forParameters(
+        const UnsignedBigInteger &pA,
+        const UnsignedBigInteger &pB,
+        const UnsignedBigInteger &pModulus
+) {
+    return forParameters(pA, pB, Montgomery::forModulus(pModulus));
+}
+
+
+const Curve *Curve::forParameters(const UnsignedBigInteger &pA, const UnsignedBigInteger &pB, const Field *pField) {
+    static std::mutex mutex;
+    static std::map<std::tuple<Digits, Digits, const Field *>, std::unique_ptr<const Curve>> curves;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    DigitResourceScope heap(nullptr); // The curves outlive the resource of the caller
+
+    // The coefficients are reduced, so that equivalent parameters share the same curve
+    const UnsignedBigInteger reducedA = pA % pField->modulus, reducedB = pB % pField->modulus;
+    std::unique_ptr<const Curve> &curve = curves[std::make_tuple(reducedA.digits, reducedB.digits, pField)];
+    if (!curve) {
+        curve = std::make_unique<const Curve>(reducedA, reducedB, pField);
+    }
+
+    return curve.get();
+}
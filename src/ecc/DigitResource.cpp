@@ -0,0 +1,40 @@
+#include "../../includes/ecc/DigitResource.h"
+
+using namespace ecc;
+
+
+namespace {
+    // nullptr stands for the global heap, which spares a dynamic initialization of the thread-local
+    thread_local std::pmr::memory_resource *currentResource = nullptr;
+}
+
+
+std::pmr::memory_resource *DigitResource::current() noexcept {
+    return currentResource != nullptr ? currentResource : std::pmr::new_delete_resource();
+}
+
+
+void *DigitResource::allocate(std::size_t bytes) {
+    std::pmr::memory_resource *resource = current();
+    auto *block = static_cast<std::byte *>(resource->allocate(HEADER_BYTES + bytes, alignof(std::max_align_t)));
+    *reinterpret_cast<std::pmr::memory_resource **>(block) = resource;
+
+    return block + HEADER_BYTES;
+}
+
+
+void DigitResource::deallocate(void *pointer, std::size_t bytes) noexcept {
+    std::byte *block = static_cast<std::byte *>(pointer) - HEADER_BYTES;
+    std::pmr::memory_resource *resource = *reinterpret_cast<std::pmr::memory_resource **>(block);
+    resource->deallocate(block, HEADER_BYTES + bytes, alignof(std::max_align_t));
+}
+
+
+DigitResourceScope::DigitResourceScope(std::pmr::memory_resource *resource) noexcept : previous(currentResource) {
+    currentResource = resource;
+}
+
+
+DigitResourceScope::~DigitResourceScope() {
+    currentResource = previous;
+}
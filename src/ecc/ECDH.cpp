@@ -0,0 +1,166 @@
+#include "../../includes/ecc/ECDH.h"
+#include "../../includes/ecc/ECDSA.h"
+
+using namespace ecc;
+
+namespace {
+    typedef FixedUnsignedInteger<Field::FIELD_LIMBS + 1> Scalar;
+
+
+    /**
+     * Parse a private key in [1, n - 1].
+     */
+    UnsignedBigInteger parsePrivateKey(std::span<const uint8_t> privateKey) {
+        if (privateKey.size() != ECDH::SECRET_BYTES) {
+            throw std::invalid_argument("Error: ECDH: invalid private key");
+        }
+
+        UnsignedBigInteger d = UnsignedBigInteger::fromBytes(privateKey);
+        if (d == 0 || d >= P256::n) {
+            throw std::invalid_argument("Error: ECDH: invalid private key");
+        }
+
+        return d;
+    }
+
+
+    /**
+     * Decode and validate the public key of a peer, and return its x-coordinate.
+     */
+    FieldElement peerAbscissa(std::span<const uint8_t> peerPublicKey) {
+        // decodePublicKey() checks the point with Point::isOnCurve()
+        return ECDSA::decodePublicKey(peerPublicKey).x;
+    }
+
+
+    /**
+     * Add k with n or 2n, so that the sum has exactly bitLength(n) + 1 bits: the ladder then starts from P and 2P,
+     * and always does the same number of steps.
+     */
+    Scalar fixLength(const UnsignedBigInteger &k, size_t topBit) {
+        const Scalar n(P256::n);
+        Scalar kn(k);
+        kn.add(n);
+        Scalar k2n(kn);
+        k2n.add(n);
+        kn.conditionalAssign(k2n, kn.getBit(topBit) ^ 1);
+        return kn;
+    }
+
+
+    /**
+     * Double (X:Z) in place: x(2P) = ((x^2 - a)^2 - 8bx) / (4(x^3 + ax + b)).
+     */
+    void doubleX(FieldElement &x, FieldElement &z, const Curve *curve) {
+        const FieldElement xx = x.square();
+        const FieldElement zz = z.square();
+        const FieldElement aZZ = curve->a * zz;
+        const FieldElement bZZZ = curve->b * (z * zz);
+        FieldElement t = xx - aZZ;
+        FieldElement u = x * bZZZ;
+        u += u;
+        u += u;
+        u += u;
+        t = t.square() - u;
+
+        u = x * (xx + aZZ) + bZZZ;
+        u *= z;
+        u += u;
+        z = u + u;
+        x = t;
+    }
+
+
+    /**
+     * Differential addition: (X0:Z0) = P0 + P1 given x(P1 - P0) = xD, with
+     * x(P0 + P1) + x(P1 - P0) = (2(x0 + x1)(x0 x1 + a) + 4b) / (x0 - x1)^2.
+     */
+    void addX(FieldElement &x0, FieldElement &z0, const FieldElement &x1, const FieldElement &z1,
+              const FieldElement &xD, const Curve *curve) {
+        const FieldElement a = x0 * z1;
+        const FieldElement b = x1 * z0;
+        const FieldElement zz = z0 * z1;
+        FieldElement numerator = (a + b) * (x0 * x1 + curve->a * zz);
+        numerator += numerator;
+        FieldElement t = curve->b * zz.square();
+        t += t;
+        numerator += t + t;
+
+        z0 = (a - b).square();
+        x0 = numerator - xD * z0;
+    }
+
+
+    /**
+     * The x-only ladder on a scalar recoded by fixLength(), whose bit topBit is set.
+     */
+    void fixedLengthLadder(const FieldElement &xP, const Scalar &scalar, size_t topBit, FieldElement &resultX,
+                           FieldElement &resultZ) {
+        const Curve *curve = P256::generator.curve;
+        const FieldElement one = FieldElement::fromValue(curve->field->fixedOne, curve->field);
+
+        // Invariant: (x1:z1) - (x0:z0) = P, starting from P and 2P
+        FieldElement x0 = xP, z0 = one, x1 = xP, z1 = one;
+        doubleX(x1, z1, curve);
+
+        for (size_t bitIndex = topBit; bitIndex-- != 0;) {
+            const Digit bit = scalar.getBit(bitIndex);
+
+            // The infinity point only enters the last step, for k in {1, n - 2, n - 1}: the addition then gives a wrong
+            // result, whereas k * P = +-P
+            const Digit exceptional = bitIndex == 0 ? static_cast<Digit>((z0 * z1).isZero()) & bit : 0;
+
+            FieldElement::conditionalSwap(x0, x1, bit);
+            FieldElement::conditionalSwap(z0, z1, bit);
+            addX(x1, z1, x0, z0, xP, curve);
+            doubleX(x0, z0, curve);
+            FieldElement::conditionalSwap(x0, x1, bit);
+            FieldElement::conditionalSwap(z0, z1, bit);
+
+            x0.value.conditionalAssign(xP.value, exceptional);
+            z0.value.conditionalAssign(one.value, exceptional);
+        }
+
+        resultX = x0;
+        resultZ = z0;
+    }
+}
+
+
+ECDH::SharedSecret ECDH::sharedSecret(std::span<const uint8_t> privateKey, std::span<const uint8_t> peerPublicKey) {
+    const UnsignedBigInteger d = parsePrivateKey(privateKey);
+    FieldElement x, z;
+    ladder(peerAbscissa(peerPublicKey), d, x, z);
+
+    SharedSecret secret{};
+    (x * z.inverse()).toUnsigned().toBytes(secret);
+    return secret;
+}
+
+
+std::vector<ECDH::SharedSecret> ECDH::sharedSecrets(
+        std::span<const uint8_t> privateKey,
+        std::span<const std::span<const uint8_t>> peerPublicKeys
+) {
+    const size_t topBit = P256::n.getMostSignificantBitIndex();
+    const Scalar scalar = fixLength(parsePrivateKey(privateKey), topBit);
+    std::vector<FieldElement> xs(peerPublicKeys.size()), zs(peerPublicKeys.size());
+    for (size_t i = 0; i < peerPublicKeys.size(); ++i) {
+        fixedLengthLadder(peerAbscissa(peerPublicKeys[i]), scalar, topBit, xs[i], zs[i]);
+    }
+
+    FieldElement::batchInvert(zs);
+    std::vector<SharedSecret> secrets(peerPublicKeys.size());
+    for (size_t i = 0; i < secrets.size(); ++i) {
+        (xs[i] * zs[i]).toUnsigned().toBytes(secrets[i]);
+    }
+
+    return secrets;
+}
+
+
+void ECDH::ladder(const FieldElement &xP, const UnsignedBigInteger &k, FieldElement &resultX,
+                  FieldElement &resultZ) {
+    const size_t topBit = P256::n.getMostSignificantBitIndex();
+    fixedLengthLadder(xP, fixLength(k, topBit), topBit, resultX, resultZ);
+}
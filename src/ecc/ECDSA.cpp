@@ -0,0 +1,327 @@
+#include <random>
+#include "../../includes/ecc/ECDSA.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/Inversion.h"
+#include "../../includes/ecc/Exponentiation.h"
+
+using namespace ecc;
+
+namespace {
+    /**
+     * Parse a scalar in [1, n - 1].
+     */
+    UnsignedBigInteger parseScalar(std::span<const uint8_t> bytes, const char *error) {
+        if (bytes.size() != ECDSA::SCALAR_BYTES) {
+            throw std::invalid_argument(error);
+        }
+
+        UnsignedBigInteger scalar = UnsignedBigInteger::fromBytes(bytes);
+        if (scalar == 0 || scalar >= P256::n) {
+            throw std::invalid_argument(error);
+        }
+
+        return scalar;
+    }
+
+
+    /**
+     * Parse a signature and the public key to verify it with, fails if any of them is malformed.
+     */
+    bool parseSignature(
+            std::span<const uint8_t> signature,
+            std::span<const uint8_t> publicKey,
+            UnsignedBigInteger &r,
+            UnsignedBigInteger &s,
+            Point &q
+    ) {
+        if (signature.size() != ECDSA::SIGNATURE_BYTES) {
+            return false;
+        }
+
+        try {
+            r = parseScalar(signature.first(ECDSA::SCALAR_BYTES), "Error: ECDSA: invalid r");
+            s = parseScalar(signature.last(ECDSA::SCALAR_BYTES), "Error: ECDSA: invalid s");
+            q = ECDSA::decodePublicKey(publicKey);
+        } catch (const std::invalid_argument &) {
+            return false;
+        }
+
+        return true;
+    }
+
+
+    /**
+     * Fill a buffer with random bytes from std::random_device.
+     */
+    void randomBytes(std::random_device &device, std::span<uint8_t> output) {
+        for (size_t i = 0; i < output.size(); i += 4) {
+            const uint32_t random = device();
+            for (size_t j = 0; j < 4 && i + j < output.size(); ++j) {
+                output[i + j] = static_cast<uint8_t>(random >> (8 * j));
+            }
+        }
+    }
+
+
+    /**
+     * Check that x(R) mod n = r, without normalizing R: x = r * z, or x = (r + n) * z when r + n is still a field
+     * element.
+     */
+    bool matchesR(const Point &rPoint, const UnsignedBigInteger &r) {
+        if (rPoint.isZero()) {
+            return false;
+        }
+
+        const Field *field = rPoint.curve->field;
+        if (FieldElement(r, field) * rPoint.z == rPoint.x) {
+            return true;
+        }
+
+        const UnsignedBigInteger rn = r + P256::n;
+        return rn < P256::m && FieldElement(rn, field) * rPoint.z == rPoint.x;
+    }
+
+
+    /**
+     * Recover the point R of a signature from r and its recovery id, fails if there is no such point.
+     */
+    bool recoverR(const UnsignedBigInteger &r, int recoveryId, Point &rPoint) {
+        const UnsignedBigInteger x = (recoveryId & 2) ? r + P256::n : r;
+        if (x >= P256::m) {
+            return false;
+        }
+
+        // y = (x^3 + ax + b)^((p + 1) / 4), since p = 3 mod 4
+        const Curve *curve = P256::generator.curve;
+        const FieldElement fx(x, curve->field);
+        const FieldElement rhs = fx.square() * fx + curve->a * fx + curve->b;
+        const FieldElement fy = Exponentiation::p256SquareRoot(rhs);
+
+        if (fy.square() != rhs) {
+            return false; // x is not the abscissa of a point
+        }
+
+        UnsignedBigInteger y = fy.toUnsigned();
+        if (y.getBit(0) != (recoveryId & 1)) {
+            y = P256::m - y;
+        }
+
+        rPoint = Point(x, y, UnsignedBigInteger(1), curve);
+        return true;
+    }
+
+
+    /**
+     * Convert a value lower than n into the Montgomery domain of the order, with a fixed-limb multiplication by
+     * r^2 mod n instead of the variable-time reduction of FieldElement(value, field).
+     */
+    FieldElement orderElement(const UnsignedBigInteger &value, const Montgomery *order) {
+        return FieldElement::fromValue(FieldElement::Value(value), order)
+               * FieldElement::fromValue(FieldElement::Value(order->r2modN), order);
+    }
+
+
+    /**
+     * Sign with the nonce k, fails if r or s is zero (the caller then has to pick another nonce).
+     */
+    bool trySign(
+            const UnsignedBigInteger &e,
+            const UnsignedBigInteger &d,
+            const UnsignedBigInteger &k,
+            ECDSA::Signature &signature,
+            int *recoveryId
+    ) {
+        const Point kG = P256::generatorTable()->multiplyConstantTime(k).normalize();
+        const UnsignedBigInteger x = kG.x.toUnsigned();
+        const UnsignedBigInteger r = x % P256::n;
+        if (r == 0) {
+            return false;
+        }
+
+        // s = k^-1 (e + r d) on fixed limbs, since d and k are secret
+        const Montgomery *order = Montgomery::forModulus(P256::n);
+        const FieldElement fs = orderElement(Inversion::safegcd(k, P256::n), order)
+                                * (orderElement(e, order) + orderElement(r, order) * orderElement(d, order));
+        if (fs.isZero()) {
+            return false;
+        }
+
+        const UnsignedBigInteger s = fs.toUnsigned();
+
+        std::span<uint8_t> output(signature);
+        r.toBytes(output.first(ECDSA::SCALAR_BYTES));
+        s.toBytes(output.last(ECDSA::SCALAR_BYTES));
+
+        if (recoveryId != nullptr) {
+            *recoveryId = kG.y.toUnsigned().getBit(0) | (x >= P256::n ? 2 : 0);
+        }
+
+        return true;
+    }
+}
+
+
+ECDSA::PublicKey ECDSA::publicKey(std::span<const uint8_t> privateKey) {
+    const UnsignedBigInteger d = parseScalar(privateKey, "Error: ECDSA: invalid private key");
+    PublicKey encoded{};
+    P256::generatorTable()->multiplyConstantTime(d).encode(encoded, false);
+    return encoded;
+}
+
+
+ECDSA::Signature ECDSA::sign(
+        std::span<const uint8_t> digest,
+        std::span<const uint8_t> privateKey,
+        int *recoveryId
+) {
+    const UnsignedBigInteger e = digestToInteger(digest);
+    const UnsignedBigInteger d = parseScalar(privateKey, "Error: ECDSA: invalid private key");
+    std::random_device device;
+    Signature signature{};
+
+    while (true) {
+        // Rejection sampling of k in [1, n - 1]
+        std::array<uint8_t, SCALAR_BYTES> nonce{};
+        randomBytes(device, nonce);
+
+        const UnsignedBigInteger k = UnsignedBigInteger::fromBytes(nonce);
+        if (k != 0 && k < P256::n && trySign(e, d, k, signature, recoveryId)) {
+            return signature;
+        }
+    }
+}
+
+
+ECDSA::Signature ECDSA::sign(
+        std::span<const uint8_t> digest,
+        std::span<const uint8_t> privateKey,
+        std::span<const uint8_t> nonce,
+        int *recoveryId
+) {
+    const UnsignedBigInteger e = digestToInteger(digest);
+    const UnsignedBigInteger d = parseScalar(privateKey, "Error: ECDSA: invalid private key");
+    const UnsignedBigInteger k = parseScalar(nonce, "Error: ECDSA: invalid nonce");
+
+    Signature signature{};
+    if (!trySign(e, d, k, signature, recoveryId)) {
+        throw std::invalid_argument("Error: ECDSA: the nonce gives a zero signature component");
+    }
+
+    return signature;
+}
+
+
+bool ECDSA::verify(
+        std::span<const uint8_t> digest,
+        std::span<const uint8_t> signature,
+        std::span<const uint8_t> publicKey
+) {
+    UnsignedBigInteger r, s;
+    Point q;
+    if (!parseSignature(signature, publicKey, r, s, q)) {
+        return false;
+    }
+
+    const Montgomery *order = Montgomery::forModulus(P256::n);
+    const UnsignedBigInteger w = Inversion::safegcd(s, P256::n);
+    const Point points[] = {P256::generator, q};
+    const UnsignedBigInteger scalars[] = {order->multiplication(digestToInteger(digest), w),
+                                          order->multiplication(r, w)};
+
+    return matchesR(Point::multiScalarMul(points, scalars), r);
+}
+
+
+std::vector<bool> ECDSA::verifyBatch(std::span<const BatchItem> items) {
+    std::vector<bool> results(items.size(), false);
+
+    // Parse the items, the malformed ones are rejected right away
+    std::vector<size_t> indexes;
+    std::vector<UnsignedBigInteger> rs;
+    std::vector<ModularBigInteger> ws;
+    std::vector<Point> qs;
+    bool recoverable = true;
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        UnsignedBigInteger r, s;
+        Point q;
+        if (parseSignature(items[i].signature, items[i].publicKey, r, s, q)) {
+            indexes.push_back(i);
+            rs.push_back(r);
+            ws.emplace_back(s, P256::n);
+            qs.push_back(q);
+            recoverable = recoverable && items[i].recoveryId >= 0 && items[i].recoveryId <= 3;
+        }
+    }
+
+    if (indexes.empty()) {
+        return results;
+    }
+
+    // w_i = s_i^-1, then u1_i = e_i * w_i and u2_i = r_i * w_i
+    ModularBigInteger::batchInvert(ws);
+    const Montgomery *order = Montgomery::forModulus(P256::n);
+    std::vector<UnsignedBigInteger> u1s(indexes.size()), u2s(indexes.size());
+    for (size_t j = 0; j < indexes.size(); ++j) {
+        u1s[j] = order->multiplication(digestToInteger(items[indexes[j]].digest), ws[j].value);
+        u2s[j] = order->multiplication(rs[j], ws[j].value);
+    }
+
+    // Randomized check: (sum z_i * u1_i) * G + sum (z_i * u2_i) * Q_i + sum z_i * (-R_i) = 0
+    if (recoverable && indexes.size() > 1) {
+        std::vector<Point> points{P256::generator};
+        std::vector<UnsignedBigInteger> scalars{UnsignedBigInteger(0)};
+        std::random_device device;
+
+        for (size_t j = 0; j < indexes.size(); ++j) {
+            Point rPoint;
+            if (!recoverR(rs[j], items[indexes[j]].recoveryId, rPoint)) {
+                recoverable = false;
+                break;
+            }
+            rPoint.y = -rPoint.y;
+
+            std::array<uint8_t, 16> randomness{};
+            randomBytes(device, randomness);
+            const UnsignedBigInteger z = UnsignedBigInteger::fromBytes(randomness);
+
+            scalars[0] = (scalars[0] + order->multiplication(z, u1s[j])) % P256::n;
+            points.push_back(qs[j]);
+            scalars.push_back(order->multiplication(z, u2s[j]));
+            points.push_back(rPoint);
+            scalars.push_back(z);
+        }
+
+        if (recoverable && Point::multiScalarMul(points, scalars).isZero()) {
+            for (size_t index : indexes) {
+                results[index] = true;
+            }
+
+            return results;
+        }
+    }
+
+    // Item per item, to locate the invalid signatures
+    for (size_t j = 0; j < indexes.size(); ++j) {
+        const Point points[] = {P256::generator, qs[j]};
+        const UnsignedBigInteger scalars[] = {u1s[j], u2s[j]};
+        results[indexes[j]] = matchesR(Point::multiScalarMul(points, scalars), rs[j]);
+    }
+
+    return results;
+}
+
+
+Point ECDSA::decodePublicKey(std::span<const uint8_t> publicKey) {
+    if (publicKey.size() != PUBLIC_KEY_BYTES && publicKey.size() != COMPRESSED_PUBLIC_KEY_BYTES) {
+        throw std::invalid_argument("Error: ECDSA: invalid public key encoding");
+    }
+
+    return Point::decode(publicKey, P256::generator.curve);
+}
+
+
+UnsignedBigInteger ECDSA::digestToInteger(std::span<const uint8_t> digest) {
+    const size_t length = digest.size() < SCALAR_BYTES ? digest.size() : SCALAR_BYTES;
+    return UnsignedBigInteger::fromBytes(digest.first(length)) % P256::n;
+}
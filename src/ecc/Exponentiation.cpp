@@ -0,0 +1,204 @@
+#include <stdexcept>
+#include "../../includes/ecc/Exponentiation.h"
+
+using namespace ecc;
+
+
+namespace {
+    /**
+     * Compute x^(2^count) in place.
+     */
+    void squareTimes(FieldElement &x, unsigned count) {
+        for (unsigned i = 0; i < count; ++i) {
+            x = x.square();
+        }
+    }
+
+
+    /**
+     * Compute the powers a^(2^k - 1) shared by the P-256 chains, for k = 2, 30 and 32.
+     */
+    void p256Powers(const FieldElement &a, FieldElement &x2, FieldElement &x30, FieldElement &x32) {
+        x2 = a.square() * a;
+        FieldElement x3 = x2.square() * a;
+        FieldElement x6 = x3;
+        squareTimes(x6, 3);
+        x6 *= x3;
+        FieldElement x12 = x6;
+        squareTimes(x12, 6);
+        x12 *= x6;
+        FieldElement x15 = x12;
+        squareTimes(x15, 3);
+        x15 *= x3;
+        x30 = x15;
+        squareTimes(x30, 15);
+        x30 *= x15;
+        x32 = x30;
+        squareTimes(x32, 2);
+        x32 *= x2;
+    }
+}
+
+
+unsigned Exponentiation::windowWidth(size_t exponentBits) {
+    return exponentBits > 671 ? 6 : exponentBits > 239 ? 5 : exponentBits > 79 ? 4 : exponentBits > 23 ? 3 : 1;
+}
+
+
+FieldElement Exponentiation::slidingWindow(const FieldElement &base, const UnsignedBigInteger &exponent) {
+    return slidingWindow(
+            base,
+            FieldElement::fromValue(base.context->fixedOne, base.context),
+            exponent,
+            [](const FieldElement &a, const FieldElement &b) { return a * b; },
+            [](const FieldElement &a) { return a.square(); }
+    );
+}
+
+
+FieldElement Exponentiation::fixedWindow(const FieldElement &base, const UnsignedBigInteger &exponent, size_t bits) {
+    const size_t fixedBits = Field::FIELD_LIMBS * UnsignedBigInteger::BITS;
+    if (bits > fixedBits || exponent.digits.size() > Field::FIELD_LIMBS) {
+        throw std::invalid_argument("Error: Exponentiation: exponent is larger than the fixed size");
+    }
+
+    // The exponent is read from fixed-size digits, its length does not leak through the bit reads
+    const FieldElement::Value fixedExponent(exponent);
+    Digit overflow = 0;
+    for (size_t bitIndex = bits; bitIndex < fixedBits; ++bitIndex) {
+        overflow |= fixedExponent.getBit(bitIndex);
+    }
+
+    if (overflow != 0) {
+        throw std::invalid_argument("Error: Exponentiation: exponent is larger than the fixed size");
+    }
+
+    // table[j] = base^j
+    const size_t tableSize = size_t(1) << FIXED_WIDTH;
+    const FieldElement one = FieldElement::fromValue(base.context->fixedOne, base.context);
+    FieldElement table[tableSize];
+    table[0] = one;
+    for (size_t j = 1; j < tableSize; ++j) {
+        table[j] = table[j - 1] * base;
+    }
+
+    FieldElement result = one;
+    for (size_t bitIndex = (bits + FIXED_WIDTH - 1) / FIXED_WIDTH * FIXED_WIDTH; bitIndex != 0;) {
+        bitIndex -= FIXED_WIDTH;
+
+        size_t window = 0;
+        for (unsigned b = FIXED_WIDTH; b-- != 0;) {
+            window = (window << 1) | fixedExponent.getBit(bitIndex + b);
+        }
+
+        FieldElement selected = one;
+        for (size_t j = 1; j < tableSize; ++j) {
+            selected.value.conditionalAssign(table[j].value, static_cast<Digit>(j == window));
+        }
+
+        squareTimes(result, FIXED_WIDTH);
+        result *= selected;
+    }
+
+    return result;
+}
+
+
+FieldElement Exponentiation::p256Inverse(const FieldElement &a) {
+    FieldElement x2, x30, x32;
+    p256Powers(a, x2, x30, x32);
+
+    // p - 2 = 1^32 0^31 1 0^96 1^94 0 1, from the most significant bit
+    FieldElement t = x32;
+    squareTimes(t, 32);
+    t *= a;
+    squareTimes(t, 96 + 32);
+    t *= x32;
+    squareTimes(t, 32);
+    t *= x32;
+    squareTimes(t, 30);
+    t *= x30;
+    squareTimes(t, 2);
+    return t * a;
+}
+
+
+FieldElement Exponentiation::p256SquareRoot(const FieldElement &a) {
+    FieldElement x2, x30, x32;
+    p256Powers(a, x2, x30, x32);
+
+    // (p + 1) / 4 = 1^32 0^31 1 0^95 1 0^94, from the most significant bit
+    FieldElement t = x32;
+    squareTimes(t, 32);
+    t *= a;
+    squareTimes(t, 96);
+    t *= a;
+    squareTimes(t, 94);
+    return t;
+}
+
+
+FieldElement Exponentiation::squareRoot(const FieldElement &a) {
+    if (isP256(a.context)) {
+        return p256SquareRoot(a);
+    }
+
+    const UnsignedBigInteger &p = a.context->modulus;
+    if (p.getBit(1)) {
+        return slidingWindow(a, (p + UnsignedBigInteger(1)) >> 2);
+    }
+
+    // Tonelli-Shanks: p - 1 = q * 2^s with q odd, and z a quadratic non-residue
+    const UnsignedBigInteger pMinusOne = p - UnsignedBigInteger(1);
+    size_t s = 1;
+    while (!pMinusOne.getBit(s)) {
+        ++s;
+    }
+    const UnsignedBigInteger q = pMinusOne >> s;
+    const FieldElement one = FieldElement::fromValue(a.context->fixedOne, a.context);
+
+    FieldElement z(UnsignedBigInteger(2), a.context);
+    while (slidingWindow(z, pMinusOne >> 1) != -one) {
+        z += one;
+    }
+
+    // Invariants: root^2 = a * t, t^(2^(m - 1)) = 1 when a is a square, and c^(2^(m - 1)) = -1
+    FieldElement c = slidingWindow(z, q);
+    FieldElement t = slidingWindow(a, q);
+    FieldElement root = slidingWindow(a, (q + UnsignedBigInteger(1)) >> 1);
+    size_t m = s;
+
+    while (!t.isZero() && !t.isOne()) {
+        // The least i such that t^(2^i) = 1
+        size_t i = 1;
+        FieldElement t2i = t.square();
+        while (i < m && !t2i.isOne()) {
+            t2i = t2i.square();
+            ++i;
+        }
+        if (i == m) {
+            break; // a is not a square
+        }
+
+        FieldElement b = c;
+        for (size_t j = i + 1; j < m; ++j) {
+            b = b.square();
+        }
+        m = i;
+        c = b.square();
+        t *= c;
+        root *= b;
+    }
+
+    return root;
+}
+
+
+bool Exponentiation::isP256(const Field *field) {
+    static const UnsignedBigInteger prime = [] {
+        DigitResourceScope heap(nullptr); // The constant outlives the resource of the caller
+        return (UnsignedBigInteger(1) << 256) - (UnsignedBigInteger(1) << 224) + (UnsignedBigInteger(1) << 192)
+               + (UnsignedBigInteger(1) << 96) - UnsignedBigInteger(1);
+    }();
+    return field->modulus == prime;
+}
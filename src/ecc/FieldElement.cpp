@@ -0,0 +1,147 @@
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Inversion.h"
+#include "../../includes/ecc/Exponentiation.h"
+
+using namespace ecc;
+
+
+FieldElement::FieldElement(const UnsignedBigInteger &pValue, const Field *pContext) {
+    if (pContext->limbs > Field::FIELD_LIMBS) {
+        throw std::overflow_error("Error: FieldElement: modulus is larger than ECC_FIELD_BITS");
+    }
+
+    context = pContext;
+    value = context->encode(pValue);
+}
+
+
+FieldElement FieldElement::fromValue(const Value &pValue, const Field *pContext) {
+    FieldElement element;
+    element.context = pContext;
+    element.value = pValue;
+
+    return element;
+}
+
+
+UnsignedBigInteger FieldElement::toUnsigned() const {
+    return context->decode(value);
+}
+
+
+FieldElement FieldElement::operator+(const FieldElement &other) const {
+    FieldElement sum(*this);
+    sum += other;
+
+    return sum;
+}
+
+
+FieldElement &FieldElement::operator+=(const FieldElement &other) {
+    // Both operands are reduced, a single subtraction of the modulus is enough
+    const Digit carry = value.add(other.value);
+    Value reduced(value);
+    const Digit borrow = reduced.subtract(context->fixedModulus);
+    value.conditionalAssign(reduced, carry | (borrow ^ 1));
+
+    return *this;
+}
+
+
+FieldElement FieldElement::operator-(const FieldElement &delta) const {
+    FieldElement difference(*this);
+    difference -= delta;
+
+    return difference;
+}
+
+
+FieldElement &FieldElement::operator-=(const FieldElement &delta) {
+    const Digit borrow = value.subtract(delta.value);
+    Value corrected(value);
+    corrected.add(context->fixedModulus);
+    value.conditionalAssign(corrected, borrow);
+
+    return *this;
+}
+
+
+FieldElement FieldElement::operator-() const {
+    FieldElement zero = fromValue(Value(), context);
+    zero -= *this;
+
+    return zero;
+}
+
+
+FieldElement FieldElement::operator*(const FieldElement &other) const {
+    FieldElement product(*this);
+    product *= other;
+
+    return product;
+}
+
+
+FieldElement &FieldElement::operator*=(const FieldElement &other) {
+    if (this == &other) {
+        *this = square();
+        return *this;
+    }
+
+    context->multiply(value, value, other.value);
+
+    return *this;
+}
+
+
+FieldElement FieldElement::square() const {
+    FieldElement result(*this);
+    context->square(result.value, value);
+
+    return result;
+}
+
+
+FieldElement FieldElement::inverse() const {
+    if (isZero()) {
+        throw std::domain_error("Error: FieldElement: zero has no inverse");
+    }
+
+    // Constant time, since the inverted coordinates may be secret (e.g. when normalizing k * G)
+    FieldElement result;
+    result.context = context;
+    context->multiply(result.value, Inversion::safegcd(value, context->fixedModulus), context->fixedInverseFactor);
+    return result;
+}
+
+
+FieldElement FieldElement::sqrt() const {
+    const FieldElement root = Exponentiation::squareRoot(*this);
+    if (root.square() != *this) {
+        throw std::domain_error("Error: FieldElement: value is not a square");
+    }
+
+    return root;
+}
+
+
+void FieldElement::batchInvert(std::span<FieldElement> elements) {
+    if (elements.empty()) {
+        return;
+    }
+
+    // prefixes[i] = elements[0] * .. * elements[i], which is zero if any element is zero
+    std::vector<FieldElement> prefixes(elements.size());
+    prefixes[0] = elements[0];
+    for (size_t i = 1; i < elements.size(); ++i) {
+        prefixes[i] = prefixes[i - 1] * elements[i];
+    }
+
+    FieldElement inverse = prefixes.back().inverse();
+    for (size_t i = elements.size() - 1; i > 0; --i) {
+        const FieldElement element = elements[i];
+        elements[i] = inverse * prefixes[i - 1];
+        inverse *= element;
+    }
+    elements[0] = inverse;
+}
@@ -0,0 +1,172 @@
+#include "../../includes/ecc/FixedBaseTable.h"
+
+using namespace ecc;
+
+namespace {
+    const char *const TABLE_MAGIC = "ecc-fixed-base-table";
+}
+
+
+FixedBaseTable::FixedBaseTable(const Point &pBase, size_t pBits, unsigned pWidth) {
+    if (pWidth < 1 || pWidth > 8) {
+        throw std::invalid_argument("Error: FixedBaseTable: width must be between 1 and 8");
+    }
+
+    base = pBase;
+    bits = pBits;
+    width = pWidth;
+
+    const size_t windows = (bits + width - 1) / width;
+    const size_t perWindow = (size_t(1) << width) - 1;
+    entries.reserve(windows * perWindow);
+
+    JacobianPoint windowBase(base);
+    for (size_t i = 0; i < windows; ++i) {
+        entries.push_back(windowBase);
+        for (size_t j = 1; j < perWindow; ++j) {
+            entries.push_back(entries.back() + windowBase);
+        }
+
+        windowBase += entries.back(); // 2^w * windowBase
+    }
+
+    JacobianPoint::normalize(entries);
+}
+
+
+Point FixedBaseTable::multiply(const UnsignedBigInteger &k) const {
+    if (k.getMostSignificantBitIndex() > bits) {
+        return base * k;
+    }
+
+    const size_t perWindow = (size_t(1) << width) - 1;
+    JacobianPoint result = JacobianPoint::infinity(base.curve);
+
+    for (size_t i = 0, bitIndex = 0; bitIndex < bits; ++i, bitIndex += width) {
+        size_t window = 0;
+        for (unsigned b = width; b-- != 0;) {
+            window = (window << 1) | k.getBit(bitIndex + b);
+        }
+
+        if (window != 0) {
+            result.addAffine(entries[i * perWindow + window - 1]);
+        }
+    }
+
+    return result.toPoint();
+}
+
+
+Point FixedBaseTable::multiplyConstantTime(const UnsignedBigInteger &k) const {
+    if (k.getMostSignificantBitIndex() > bits) {
+        throw std::invalid_argument("Error: FixedBaseTable: scalar is larger than the table");
+    }
+
+    const Field *field = base.curve->field;
+    const FieldElement zero = FieldElement::fromValue(FieldElement::Value(), field);
+    const FieldElement one = FieldElement::fromValue(field->fixedOne, field);
+    const Point infinity = base.factory(zero, one, zero);
+    const FieldElement::Value scalar(k);
+    const size_t perWindow = (size_t(1) << width) - 1;
+    Point result = infinity;
+
+    for (size_t i = 0, bitIndex = 0; bitIndex < bits; ++i, bitIndex += width) {
+        size_t window = 0;
+        for (unsigned b = width; b-- != 0;) {
+            window = (window << 1) | (bitIndex + b < Field::FIELD_LIMBS * UnsignedBigInteger::BITS
+                                      ? scalar.getBit(bitIndex + b) : 0);
+        }
+
+        // Affine entries (x, y, 1) are also valid homogeneous coordinates, a zero window selects (0:1:0)
+        Point selected = infinity;
+        for (size_t j = 1; j <= perWindow; ++j) {
+            const JacobianPoint &entry = entries[i * perWindow + j - 1];
+            const Digit condition = static_cast<Digit>(j == window);
+            selected.x.value.conditionalAssign(entry.x.value, condition);
+            selected.y.value.conditionalAssign(entry.y.value, condition);
+            selected.z.value.conditionalAssign(one.value, condition);
+        }
+
+        result = result.completeAdd(selected);
+    }
+
+    return result;
+}
+
+
+void FixedBaseTable::save(std::ostream &outputStream) const {
+    outputStream << TABLE_MAGIC << ' ' << width << ' ' << bits << ' ' << entries.size() << '\n';
+
+    for (const JacobianPoint &entry : entries) {
+        if (entry.isZero()) {
+            outputStream << "0 0\n";
+        } else {
+            outputStream << entry.x.toUnsigned().toHex() << ' ' << entry.y.toUnsigned().toHex() << '\n';
+        }
+    }
+}
+
+
+FixedBaseTable FixedBaseTable::load(std::istream &inputStream, const Point &pBase) {
+    std::string magic;
+    FixedBaseTable table;
+    size_t count = 0;
+
+    inputStream >> magic >> table.width >> table.bits >> count;
+    if (!inputStream || magic != TABLE_MAGIC || table.width < 1 || table.width > 8 ||
+        count != (table.bits + table.width - 1) / table.width * ((size_t(1) << table.width) - 1)) {
+        throw std::invalid_argument("Error: FixedBaseTable: invalid table header");
+    }
+
+    table.base = pBase;
+    table.entries.reserve(count);
+
+    const JacobianPoint origin(pBase);
+    const FieldElement one = FieldElement::fromValue(pBase.curve->field->fixedOne, pBase.curve->field);
+    std::string x, y;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!(inputStream >> x >> y)) {
+            throw std::invalid_argument("Error: FixedBaseTable: truncated table");
+        }
+
+        if (x == "0" && y == "0") {
+            table.entries.push_back(JacobianPoint::infinity(pBase.curve));
+            continue;
+        }
+
+        const Field *field = pBase.curve->field;
+        JacobianPoint entry = origin.factory(FieldElement(UnsignedBigInteger::fromHex(x), field),
+                                             FieldElement(UnsignedBigInteger::fromHex(y), field), one);
+        if (!entry.toPoint().isOnCurve()) {
+            throw std::invalid_argument("Error: FixedBaseTable: entry is not on the curve");
+        }
+
+        table.entries.push_back(entry);
+    }
+
+    if (table.entries.empty()) {
+        throw std::invalid_argument("Error: FixedBaseTable: table does not match the base point");
+    }
+
+    // Every entry must be its multiple of the base: the windows are walked again like in the constructor, with one
+    // mixed addition per entry and no inversion
+    const size_t perWindow = (size_t(1) << table.width) - 1;
+    JacobianPoint multiple(pBase);
+    for (size_t i = 0; i < count; i += perWindow) {
+        const JacobianPoint &windowBase = table.entries[i];
+        for (size_t j = 0; j < perWindow; ++j) {
+            if (j > 0) {
+                multiple.addAffine(windowBase);
+            }
+
+            if (multiple.toPoint() != table.entries[i + j].toPoint()) {
+                throw std::invalid_argument("Error: FixedBaseTable: table does not match the base point");
+            }
+        }
+
+        multiple.addAffine(windowBase); // 2^w * windowBase, the base of the next window
+    }
+
+    return table;
+}
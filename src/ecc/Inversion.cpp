@@ -0,0 +1,313 @@
+#include "../../includes/ecc/Inversion.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/Exponentiation.h"
+
+using namespace ecc;
+
+
+namespace {
+    typedef Inversion::Value Value;
+
+    const unsigned BITS = UnsignedBigInteger::BITS;
+
+
+    /**
+     * Shift right by one bit in place, shifting in the given top bit.
+     */
+    template<size_t N>
+    void shiftRightOne(FixedUnsignedInteger<N> &value, Digit topBit) {
+        for (size_t j = 0; j + 1 < N; ++j) {
+            value.digits[j] = (value.digits[j] >> 1) | (value.digits[j + 1] << (BITS - 1));
+        }
+        value.digits[N - 1] = (value.digits[N - 1] >> 1) | (topBit << (BITS - 1));
+    }
+
+
+    /**
+     * x / 2 mod m, with m odd: adds m first when x is odd, without branching.
+     */
+    void halve(Value &x, const Value &m) {
+        const Digit odd = x.digits[0] & 1;
+        Value sum(x);
+        const Digit carry = sum.add(m);
+        x.conditionalAssign(sum, odd);
+        shiftRightOne(x, carry & odd);
+    }
+
+
+    /**
+     * x - y mod m, for x, y lower than m, without branching.
+     */
+    void subtractModulo(Value &x, const Value &y, const Value &m) {
+        const Digit borrow = x.subtract(y);
+        Value sum(x);
+        sum.add(m);
+        x.conditionalAssign(sum, borrow);
+    }
+
+
+    /*
+     * safegcd works on signed integers cut in 30-bit limbs (the "signed30" representation of libsecp256k1's
+     * modinv32): value = sum of v[i] * 2^(30 i), where the lower limbs are in [0, 2^30) and the top one is signed.
+     * Products of a limb by a matrix coefficient then fit in 64 bits, whatever the digit size.
+     */
+    const int32_t M30 = static_cast<int32_t>(UINT32_MAX >> 2);
+    const size_t VALUE_BITS = Field::FIELD_LIMBS * BITS;
+    const size_t LIMBS30 = VALUE_BITS / 30 + 1;
+
+    typedef std::array<int32_t, LIMBS30> Signed30;
+
+
+    /**
+     * Transition matrix of 30 divsteps, scaled by 2^30.
+     */
+    struct Transition {
+        int32_t u, v, q, r;
+    };
+
+
+    Signed30 toSigned30(const Value &value) {
+        Signed30 limbs{};
+        for (size_t bit = 0; bit < VALUE_BITS; ++bit) {
+            limbs[bit / 30] |= static_cast<int32_t>(value.getBit(bit)) << (bit % 30);
+        }
+
+        return limbs;
+    }
+
+
+    Value fromSigned30(const Signed30 &limbs) {
+        Value value;
+        for (size_t bit = 0; bit < VALUE_BITS; ++bit) {
+            value.digits[bit / BITS] |= static_cast<Digit>((limbs[bit / 30] >> (bit % 30)) & 1) << (bit % BITS);
+        }
+
+        return value;
+    }
+
+
+    /**
+     * 30 half-delta divsteps on the low bits of f and g, with zeta = -(delta + 1/2). Returns the new zeta and the
+     * matrix t such that t * [f, g] = 2^30 * [f', g'].
+     */
+    int32_t divsteps30(int32_t zeta, uint32_t f, uint32_t g, Transition &t) {
+        // Matrix coefficients in [-2^30, 2^30], computed modulo 2^32
+        uint32_t u = 1, v = 0, q = 0, r = 1;
+
+        for (int i = 0; i < 30; ++i) {
+            // If zeta < 0 and g is odd: (f, g) = (g, (g - f) / 2), else if g is odd: g = (g + f) / 2, else g = g / 2
+            uint32_t negative = static_cast<uint32_t>(zeta >> 31);
+            const uint32_t odd = -(g & 1);
+            g += ((f ^ negative) - negative) & odd;
+            q += ((u ^ negative) - negative) & odd;
+            r += ((v ^ negative) - negative) & odd;
+
+            negative &= odd;
+            zeta = (zeta ^ static_cast<int32_t>(negative)) - 1;
+            f += g & negative;
+            u += q & negative;
+            v += r & negative;
+
+            g >>= 1;
+            u <<= 1;
+            v <<= 1;
+        }
+
+        t = {static_cast<int32_t>(u), static_cast<int32_t>(v), static_cast<int32_t>(q), static_cast<int32_t>(r)};
+        return zeta;
+    }
+
+
+    /**
+     * [f, g] = t * [f, g] / 2^30, which is exact.
+     */
+    void updateFG(Signed30 &f, Signed30 &g, const Transition &t) {
+        int64_t cf = static_cast<int64_t>(t.u) * f[0] + static_cast<int64_t>(t.v) * g[0];
+        int64_t cg = static_cast<int64_t>(t.q) * f[0] + static_cast<int64_t>(t.r) * g[0];
+        cf >>= 30;
+        cg >>= 30;
+
+        for (size_t i = 1; i < LIMBS30; ++i) {
+            cf += static_cast<int64_t>(t.u) * f[i] + static_cast<int64_t>(t.v) * g[i];
+            cg += static_cast<int64_t>(t.q) * f[i] + static_cast<int64_t>(t.r) * g[i];
+            f[i - 1] = static_cast<int32_t>(cf) & M30;
+            g[i - 1] = static_cast<int32_t>(cg) & M30;
+            cf >>= 30;
+            cg >>= 30;
+        }
+
+        f[LIMBS30 - 1] = static_cast<int32_t>(cf);
+        g[LIMBS30 - 1] = static_cast<int32_t>(cg);
+    }
+
+
+    /**
+     * [d, e] = t * [d, e] / 2^30 mod m: multiples of m are added so that the division is exact, and d, e stay in
+     * (-2m, m).
+     */
+    void updateDE(Signed30 &d, Signed30 &e, const Transition &t, const Signed30 &m, uint32_t mInverse30) {
+        const int32_t sd = d[LIMBS30 - 1] >> 31, se = e[LIMBS30 - 1] >> 31;
+        int32_t md = (t.u & sd) + (t.v & se);
+        int32_t me = (t.q & sd) + (t.r & se);
+
+        int64_t cd = static_cast<int64_t>(t.u) * d[0] + static_cast<int64_t>(t.v) * e[0];
+        int64_t ce = static_cast<int64_t>(t.q) * d[0] + static_cast<int64_t>(t.r) * e[0];
+        md -= static_cast<int32_t>((mInverse30 * static_cast<uint32_t>(cd) + static_cast<uint32_t>(md)) & M30);
+        me -= static_cast<int32_t>((mInverse30 * static_cast<uint32_t>(ce) + static_cast<uint32_t>(me)) & M30);
+        cd += static_cast<int64_t>(m[0]) * md;
+        ce += static_cast<int64_t>(m[0]) * me;
+        cd >>= 30;
+        ce >>= 30;
+
+        for (size_t i = 1; i < LIMBS30; ++i) {
+            cd += static_cast<int64_t>(t.u) * d[i] + static_cast<int64_t>(t.v) * e[i];
+            ce += static_cast<int64_t>(t.q) * d[i] + static_cast<int64_t>(t.r) * e[i];
+            cd += static_cast<int64_t>(m[i]) * md;
+            ce += static_cast<int64_t>(m[i]) * me;
+            d[i - 1] = static_cast<int32_t>(cd) & M30;
+            e[i - 1] = static_cast<int32_t>(ce) & M30;
+            cd >>= 30;
+            ce >>= 30;
+        }
+
+        d[LIMBS30 - 1] = static_cast<int32_t>(cd);
+        e[LIMBS30 - 1] = static_cast<int32_t>(ce);
+    }
+
+
+    /**
+     * Carry the limbs of x to bring them back to [0, 2^30), except the signed top one.
+     */
+    void carry30(Signed30 &x) {
+        for (size_t i = 0; i + 1 < LIMBS30; ++i) {
+            x[i + 1] += x[i] >> 30;
+            x[i] &= M30;
+        }
+    }
+
+
+    /**
+     * Bring d from (-2m, m) to [0, m), negated if f is negative, without branching.
+     */
+    void normalize(Signed30 &d, int32_t fSign, const Signed30 &m) {
+        int32_t add = d[LIMBS30 - 1] >> 31;
+        for (size_t i = 0; i < LIMBS30; ++i) {
+            d[i] += m[i] & add;
+        }
+
+        const int32_t negate = fSign >> 31;
+        for (size_t i = 0; i < LIMBS30; ++i) {
+            d[i] = (d[i] ^ negate) - negate;
+        }
+        carry30(d);
+
+        add = d[LIMBS30 - 1] >> 31;
+        for (size_t i = 0; i < LIMBS30; ++i) {
+            d[i] += m[i] & add;
+        }
+        carry30(d);
+    }
+}
+
+
+Value Inversion::binary(const Value &a, const Value &modulus) {
+    // Invariants: x1 * a = u and x2 * a = v (mod modulus)
+    Value u(a), v(modulus), x1(1), x2(0);
+    const Value one(1);
+
+    while (u != one && v != one) {
+        if (u.isZero() || v.isZero()) {
+            throw std::domain_error("Error: Inversion: value is not invertible");
+        }
+
+        while ((u.digits[0] & 1) == 0) {
+            shiftRightOne(u, 0);
+            halve(x1, modulus);
+        }
+
+        while ((v.digits[0] & 1) == 0) {
+            shiftRightOne(v, 0);
+            halve(x2, modulus);
+        }
+
+        if (u >= v) {
+            u.subtract(v);
+            subtractModulo(x1, x2, modulus);
+        } else {
+            v.subtract(u);
+            subtractModulo(x2, x1, modulus);
+        }
+    }
+
+    return u == one ? x1 : x2;
+}
+
+
+UnsignedBigInteger Inversion::binary(const UnsignedBigInteger &a, const UnsignedBigInteger &modulus) {
+    if (modulus.digits.size() > Field::FIELD_LIMBS || (modulus.digits[0] & 1) == 0) {
+        const UnsignedBigInteger inverse = Montgomery::knuthModularInverse(a % modulus, modulus);
+        if (inverse == 0) {
+            throw std::domain_error("Error: Inversion: value is not invertible");
+        }
+
+        return inverse;
+    }
+
+    return binary(Value(a % modulus), Value(modulus)).toUnsigned();
+}
+
+
+Value Inversion::safegcd(const Value &a, const Value &modulus) {
+    // Invariants: f = d * a and g = e * a (mod modulus), f stays odd
+    const Signed30 m = toSigned30(modulus);
+    Signed30 f = m, g = toSigned30(a), d{}, e{};
+    e[0] = 1;
+    int32_t zeta = -1; // delta = 1/2
+
+    // modulus^-1 mod 2^30, by Newton iteration
+    const auto m0 = static_cast<uint32_t>(m[0]);
+    uint32_t mInverse30 = m0;
+    for (int i = 0; i < 4; ++i) {
+        mInverse30 *= 2 - m0 * mInverse30;
+    }
+    mInverse30 &= static_cast<uint32_t>(M30);
+
+    // Iteration bound of the half-delta divsteps for VALUE_BITS-bit inputs (590 for 256 bits), after which g = 0
+    const size_t iterations = (45907 * VALUE_BITS + 26313) / 19929;
+    for (size_t i = 0; i < iterations; i += 30) {
+        Transition t{};
+        zeta = divsteps30(zeta, static_cast<uint32_t>(f[0]), static_cast<uint32_t>(g[0]), t);
+        updateDE(d, e, t, m, mInverse30);
+        updateFG(f, g, t);
+    }
+
+    // f = +-gcd(a, modulus)
+    const int32_t fSign = f[LIMBS30 - 1] >> 31;
+    for (size_t i = 0; i < LIMBS30; ++i) {
+        const int32_t expected = i == 0 ? 1 : 0;
+        if (f[i] != (fSign ? (i + 1 == LIMBS30 ? -1 : M30) : expected)) {
+            throw std::domain_error("Error: Inversion: value is not invertible");
+        }
+    }
+
+    normalize(d, fSign, m);
+    return fromSigned30(d);
+}
+
+
+UnsignedBigInteger Inversion::safegcd(const UnsignedBigInteger &a, const UnsignedBigInteger &modulus) {
+    if (modulus.digits.size() > Field::FIELD_LIMBS || (modulus.digits[0] & 1) == 0) {
+        throw std::invalid_argument("Error: Inversion: safegcd needs an odd modulus of at most ECC_FIELD_BITS bits");
+    }
+
+    return safegcd(Value(a), Value(modulus)).toUnsigned();
+}
+
+
+FieldElement Inversion::fermatP256(const FieldElement &a) {
+    if (a.isZero()) {
+        throw std::domain_error("Error: Inversion: value is not invertible");
+    }
+
+    return Exponentiation::p256Inverse(a);
+}
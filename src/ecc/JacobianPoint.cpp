@@ -0,0 +1,443 @@
+#include "../../includes/ecc/JacobianPoint.h"
+
+using namespace ecc;
+
+
+namespace {
+    /**
+     * Odd multiples table of the wNAF methods: table[i] = (2i + 1)P, for i < 2^(w-2).
+     */
+    std::vector<JacobianPoint> oddMultiples(const JacobianPoint &point, unsigned width) {
+        std::vector<JacobianPoint> table(size_t(1) << (width - 2));
+        const JacobianPoint doubled = point.twice();
+        table[0] = point;
+        for (size_t i = 1; i < table.size(); ++i) {
+            table[i] = table[i - 1] + doubled;
+        }
+
+        return table;
+    }
+
+
+    /**
+     * Add the signed multiple digit * P of a wNAF odd multiples table, with the mixed addition if the table is affine.
+     */
+    void addDigit(JacobianPoint &result, const JacobianPoint *table, int digit, bool affine) {
+        const JacobianPoint addend = digit > 0 ? table[digit / 2] : -table[-digit / 2];
+        if (affine) {
+            result.addAffine(addend);
+        } else {
+            result += addend;
+        }
+    }
+
+
+    /**
+     * Indexes of the terms of a multi-scalar multiplication which contribute to the sum: the points at infinity have
+     * no odd multiples table, and the zero scalars add nothing.
+     */
+    std::vector<size_t> contributingTerms(std::span<const JacobianPoint> points,
+                                          std::span<const UnsignedBigInteger> scalars) {
+        std::vector<size_t> terms;
+        for (size_t j = 0; j < points.size(); ++j) {
+            if (!points[j].isZero() && scalars[j] != 0) {
+                terms.push_back(j);
+            }
+        }
+
+        return terms;
+    }
+}
+
+JacobianPoint::JacobianPoint(const Point &point) {
+    curve = point.curve;
+
+    if (curve) {
+        aIsMinusThree = curve->aIsMinusThree;
+    }
+
+    if (point.isZero()) {
+        *this = infinity(curve);
+        return;
+    }
+
+    x = point.x * point.z;
+    y = point.y * point.z.square();
+    z = point.z;
+}
+
+
+Point JacobianPoint::toPoint() const {
+    if (isZero()) {
+        return Point::infinity(curve);
+    }
+
+    Point point;
+    point.curve = curve;
+
+    point.x = x * z;
+    point.y = y;
+    point.z = z.square() * z;
+    return point;
+}
+
+
+JacobianPoint JacobianPoint::factory(const FieldElement &pX, const FieldElement &pY, const FieldElement &pZ) const {
+    JacobianPoint build;
+    build.curve = curve;
+    build.x = pX;
+    build.y = pY;
+    build.z = pZ;
+    build.aIsMinusThree = aIsMinusThree;
+    return build;
+}
+
+
+JacobianPoint JacobianPoint::infinity(const Curve *pCurve) {
+    JacobianPoint build;
+    if (pCurve == nullptr) {
+        return build;
+    }
+
+    build.curve = pCurve;
+    build.aIsMinusThree = pCurve->aIsMinusThree;
+    build.x = FieldElement::fromValue(FieldElement::Value(), pCurve->field);
+    build.y = FieldElement::fromValue(pCurve->field->fixedOne, pCurve->field);
+    build.z = build.x;
+    return build;
+}
+
+
+JacobianPoint JacobianPoint::twice() const {
+    if (isZero() || y.isZero()) {
+        return infinity(curve);
+    }
+
+    if (aIsMinusThree) {
+        // dbl-2001-b: alpha = 3(x - z^2)(x + z^2) replaces 3x^2 + az^4
+        FieldElement delta = z.square();
+        FieldElement gamma = y.square();
+        FieldElement beta = x * gamma;
+        FieldElement alpha = (x - delta) * (x + delta);
+        alpha += alpha + alpha;
+        FieldElement beta4 = beta + beta;
+        beta4 += beta4;
+        FieldElement rx = alpha.square() - beta4 - beta4;
+        FieldElement rz = (y + z).square() - gamma - delta;
+        FieldElement gamma8 = gamma.square();
+        gamma8 += gamma8;
+        gamma8 += gamma8;
+        gamma8 += gamma8;
+        FieldElement ry = alpha * (beta4 - rx) - gamma8;
+
+        return factory(rx, ry, rz);
+    }
+
+    // dbl-2007-bl
+    FieldElement xx = x.square();
+    FieldElement yy = y.square();
+    FieldElement yyyy = yy.square();
+    FieldElement zz = z.square();
+    FieldElement s = (x + yy).square() - xx - yyyy;
+    s += s;
+    FieldElement m = xx + xx + xx + curve->a * zz.square();
+    FieldElement rx = m.square() - s - s;
+    FieldElement yyyy8 = yyyy + yyyy;
+    yyyy8 += yyyy8;
+    yyyy8 += yyyy8;
+    FieldElement ry = m * (s - rx) - yyyy8;
+    FieldElement rz = (y + z).square() - yy - zz;
+
+    return factory(rx, ry, rz);
+}
+
+
+JacobianPoint JacobianPoint::operator+(const JacobianPoint &other) const {
+    JacobianPoint sum(*this);
+    sum += other;
+    return sum;
+}
+
+
+JacobianPoint &JacobianPoint::operator+=(const JacobianPoint &other) {
+    if (other.isZero()) {
+        return *this;
+    } else if (isZero()) {
+        *this = other;
+        return *this;
+    }
+
+    // add-2007-bl
+    FieldElement z1z1 = z.square();
+    FieldElement z2z2 = other.z.square();
+    FieldElement u1 = x * z2z2;
+    FieldElement u2 = other.x * z1z1;
+    FieldElement s1 = y * other.z * z2z2;
+    FieldElement s2 = other.y * z * z1z1;
+    FieldElement h = u2 - u1;
+    FieldElement r = s2 - s1;
+
+    if (h.isZero()) {
+        if (r.isZero()) {
+            // Both points are the same, simply double
+            *this = twice();
+        } else {
+            *this = infinity(curve);
+        }
+        return *this;
+    }
+
+    FieldElement i = (h + h).square();
+    FieldElement j = h * i;
+    r += r;
+    FieldElement v = u1 * i;
+    FieldElement rx = r.square() - j - v - v;
+    FieldElement s1j = s1 * j;
+    FieldElement ry = r * (v - rx) - s1j - s1j;
+    FieldElement rz = ((z + other.z).square() - z1z1 - z2z2) * h;
+
+    *this = factory(rx, ry, rz);
+    return *this;
+}
+
+
+JacobianPoint &JacobianPoint::addAffine(const JacobianPoint &other) {
+    if (other.isZero()) {
+        return *this;
+    } else if (isZero()) {
+        *this = other;
+        return *this;
+    }
+
+    // madd-2007-bl
+    FieldElement z1z1 = z.square();
+    FieldElement u2 = other.x * z1z1;
+    FieldElement s2 = other.y * z * z1z1;
+    FieldElement h = u2 - x;
+    FieldElement r = s2 - y;
+
+    if (h.isZero()) {
+        if (r.isZero()) {
+            *this = twice();
+        } else {
+            *this = infinity(curve);
+        }
+        return *this;
+    }
+
+    FieldElement hh = h.square();
+    FieldElement i = hh + hh;
+    i += i;
+    FieldElement j = h * i;
+    r += r;
+    FieldElement v = x * i;
+    FieldElement rx = r.square() - j - v - v;
+    FieldElement yj = y * j;
+    FieldElement ry = r * (v - rx) - yj - yj;
+    FieldElement rz = (z + h).square() - z1z1 - hh;
+
+    *this = factory(rx, ry, rz);
+    return *this;
+}
+
+
+JacobianPoint JacobianPoint::normalize() const {
+    if (isZero()) {
+        return *this;
+    }
+
+    FieldElement invZ = z.inverse();
+    FieldElement invZ2 = invZ.square();
+    return factory(x * invZ2, y * invZ2 * invZ, FieldElement::fromValue(curve->field->fixedOne, curve->field));
+}
+
+
+void JacobianPoint::normalize(std::vector<JacobianPoint> &points) {
+    std::vector<size_t> indexes;
+    std::vector<FieldElement> inverses;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].isZero()) {
+            indexes.push_back(i);
+            inverses.push_back(points[i].z);
+        }
+    }
+
+    FieldElement::batchInvert(inverses);
+    for (size_t t = 0; t < indexes.size(); ++t) {
+        JacobianPoint &point = points[indexes[t]];
+        const FieldElement invZ2 = inverses[t].square();
+        point = point.factory(point.x * invZ2, point.y * invZ2 * inverses[t],
+                              FieldElement::fromValue(point.curve->field->fixedOne, point.curve->field));
+    }
+}
+
+
+JacobianPoint JacobianPoint::operator*(const UnsignedBigInteger &other) const {
+    JacobianPoint product(*this);
+    product *= other;
+    return product;
+}
+
+
+JacobianPoint &JacobianPoint::operator*=(const UnsignedBigInteger &p) {
+    *this = multiply(p);
+    return *this;
+}
+
+
+JacobianPoint JacobianPoint::operator-() const {
+    return factory(x, -y, z);
+}
+
+
+JacobianPoint JacobianPoint::multiply(const UnsignedBigInteger &k, unsigned width) const {
+    const std::vector<int8_t> naf = k.getNonAdjacentForm(width);
+    JacobianPoint result = infinity(curve);
+
+    if (isZero() || naf.empty()) {
+        return result;
+    }
+
+    const std::vector<JacobianPoint> table = oddMultiples(*this, width);
+
+    // The base point alone may be added with the cheaper mixed addition when it is affine
+    const bool isAffine = z.isOne();
+
+    for (size_t bitIndex = naf.size(); bitIndex-- != 0;) {
+        result = result.twice();
+
+        const int8_t digit = naf[bitIndex];
+        if (digit == 0) {
+            continue;
+        }
+
+        const JacobianPoint &addend = table[(digit > 0 ? digit : -digit) / 2];
+        const JacobianPoint signedAddend = digit > 0 ? addend : -addend;
+        if (isAffine && (digit == 1 || digit == -1)) {
+            result.addAffine(signedAddend);
+        } else {
+            result += signedAddend;
+        }
+    }
+
+    return result;
+}
+
+
+JacobianPoint JacobianPoint::interleavedWnaf(
+        std::span<const JacobianPoint> points,
+        std::span<const UnsignedBigInteger> scalars,
+        unsigned width
+) {
+    const std::vector<size_t> terms = contributingTerms(points, scalars);
+    if (terms.empty()) {
+        return infinity(points.empty() ? nullptr : points[0].curve);
+    }
+
+    // The odd multiples tables, one after the other: tables[j * stride + i] = (2i + 1) P_terms[j]
+    const size_t stride = size_t(1) << (width - 2);
+    std::vector<JacobianPoint> tables;
+    std::vector<std::vector<int8_t>> nafs;
+    size_t length = 0;
+
+    tables.reserve(terms.size() * stride);
+    for (size_t term : terms) {
+        const std::vector<JacobianPoint> table = oddMultiples(points[term], width);
+        tables.insert(tables.end(), table.begin(), table.end());
+        nafs.push_back(scalars[term].getNonAdjacentForm(width));
+        length = std::max(length, nafs.back().size());
+    }
+
+    // With enough terms, a shared inversion is cheaper than the full additions it saves
+    const bool affine = terms.size() >= AFFINE_TABLE_THRESHOLD;
+    if (affine) {
+        normalize(tables);
+    }
+
+    // A single doubling chain for all the terms
+    JacobianPoint result = infinity(points[terms[0]].curve);
+    for (size_t bitIndex = length; bitIndex-- != 0;) {
+        result = result.twice();
+
+        for (size_t j = 0; j < terms.size(); ++j) {
+            if (bitIndex < nafs[j].size() && nafs[j][bitIndex] != 0) {
+                addDigit(result, &tables[j * stride], nafs[j][bitIndex], affine);
+            }
+        }
+    }
+
+    return result;
+}
+
+
+JacobianPoint JacobianPoint::pippenger(std::span<const JacobianPoint> points, std::span<const UnsignedBigInteger> scalars) {
+    const std::vector<size_t> terms = contributingTerms(points, scalars);
+    if (terms.empty()) {
+        return infinity(points.empty() ? nullptr : points[0].curve);
+    }
+
+    size_t bits = 0;
+    for (size_t term : terms) {
+        bits = std::max(bits, scalars[term].getMostSignificantBitIndex());
+    }
+
+    // Window width c ~ log2(n) - 2 balances the n bucket additions against the 2^c additions of the running sums
+    unsigned c = 2;
+    while (c < 16 && (size_t(1) << (c + 3)) <= terms.size()) {
+        ++c;
+    }
+    const size_t windows = bits / c + 1; // The last window absorbs the carry of the signed digits
+
+    // Signed digits in [-2^(c-1), 2^(c-1)], so that only 2^(c-1) buckets are needed
+    std::vector<int32_t> digits(terms.size() * windows);
+    for (size_t j = 0; j < terms.size(); ++j) {
+        int32_t carry = 0;
+        for (size_t w = 0; w < windows; ++w) {
+            int32_t digit = carry;
+            for (unsigned b = 0; b < c; ++b) {
+                digit += static_cast<int32_t>(scalars[terms[j]].getBit(w * c + b)) << b;
+            }
+
+            carry = digit > (1 << (c - 1)) ? 1 : 0;
+            digits[j * windows + w] = digit - (carry << c);
+        }
+    }
+
+    // Affine copies of the points, so that the buckets are filled with mixed additions
+    std::vector<JacobianPoint> affinePoints;
+    for (size_t term : terms) {
+        affinePoints.push_back(points[term]);
+    }
+    normalize(affinePoints);
+
+    const JacobianPoint zero = infinity(points[terms[0]].curve);
+    std::vector<JacobianPoint> buckets(size_t(1) << (c - 1));
+    JacobianPoint result = zero;
+
+    for (size_t w = windows; w-- != 0;) {
+        for (unsigned b = 0; b < c; ++b) {
+            result = result.twice();
+        }
+
+        std::fill(buckets.begin(), buckets.end(), zero);
+        for (size_t j = 0; j < terms.size(); ++j) {
+            const int32_t digit = digits[j * windows + w];
+            if (digit > 0) {
+                buckets[digit - 1].addAffine(affinePoints[j]);
+            } else if (digit < 0) {
+                buckets[-digit - 1].addAffine(-affinePoints[j]);
+            }
+        }
+
+        // sum over i of (i + 1) * buckets[i], with running sums
+        JacobianPoint runningSum = zero, windowSum = zero;
+        for (size_t i = buckets.size(); i-- != 0;) {
+            runningSum += buckets[i];
+            windowSum += runningSum;
+        }
+
+        result += windowSum;
+    }
+
+    return result;
+}
@@ -1,9 +1,50 @@
+#include <array>
+#include <memory>
 #include "../../includes/ecc/ModularBigInteger.h"
 #include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/Inversion.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Exponentiation.h"
+#include "../../includes/ecc/DigitResource.h"
 
 using namespace ecc;
 
 
+namespace {
+    const size_t CACHED_CONTEXTS = 4;
+
+
+    /**
+     * Get the Montgomery context of a modulus from a small per-thread cache, replaced in round robin. Unlike the
+     * interned contexts of Montgomery::forModulus(), which are never released, the ad-hoc moduli then hold a bounded
+     * amount of memory, while a run of operations on the same modulus still builds its context once.
+     * @param modulus The modulus.
+     * @return The context, valid until the next call on the thread, or nullptr when the modulus is even.
+     */
+    const Montgomery *contextOf(const UnsignedBigInteger &modulus) {
+        thread_local std::array<std::unique_ptr<const Montgomery>, CACHED_CONTEXTS> contexts;
+        thread_local size_t next = 0;
+
+        if (!modulus.getBit(0)) {
+            return nullptr;
+        }
+
+        for (const std::unique_ptr<const Montgomery> &context : contexts) {
+            if (context && context->modulus == modulus) {
+                return context.get();
+            }
+        }
+
+        DigitResourceScope heap(nullptr); // The contexts outlive the resource of the caller
+        std::unique_ptr<const Montgomery> &slot = contexts[next];
+        slot = std::make_unique<const Montgomery>(modulus);
+        next = (next + 1) % CACHED_CONTEXTS;
+
+        return slot.get();
+    }
+}
+
+
 ModularBigInteger ModularBigInteger::operator+(const ModularBigInteger &other) {
     ModularBigInteger sum(*this);
     sum += other;
@@ -47,7 +88,90 @@ ModularBigInteger ModularBigInteger::operator*(const ModularBigInteger &other) c
 }
 
 ModularBigInteger &ModularBigInteger::operator*=(const ModularBigInteger &other) {
-    Montgomery montgomery(modulus);
-    value = montgomery.multiplication(value, other.value);
+    if (this == &other) {
+        *this = square();
+        return *this;
+    }
+
+    if (const Montgomery *context = contextOf(modulus)) {
+        value = context->multiplication(value, other.value);
+    } else {
+        value = (value * other.value) % modulus; // Montgomery reduction needs an odd modulus
+    }
+
     return *this;
 }
+
+
+ModularBigInteger ModularBigInteger::square() const {
+    ModularBigInteger result(*this);
+    if (const Montgomery *context = contextOf(modulus)) {
+        // (a^2 * r^-1) * r^2 * r^-1 = a^2, two reductions like Montgomery::multiplication()
+        const UnsignedBigInteger reduced = value < modulus ? value : value % modulus;
+        result.value = context->montgomery(context->montgomerySquare(reduced), context->r2modN);
+    } else {
+        result.value = value.square() % modulus;
+    }
+
+    return result;
+}
+
+
+ModularBigInteger ModularBigInteger::pow(const UnsignedBigInteger &exponent) const {
+    ModularBigInteger result(*this);
+    if (const Montgomery *context = contextOf(modulus)) {
+        result.value = context->pow(value, exponent);
+        return result;
+    }
+
+    result.value = Exponentiation::slidingWindow(
+            value % modulus,
+            UnsignedBigInteger(1) % modulus,
+            exponent,
+            [this](const UnsignedBigInteger &a, const UnsignedBigInteger &b) { return (a * b) % modulus; },
+            [this](const UnsignedBigInteger &a) { return a.square() % modulus; }
+    );
+
+    return result;
+}
+
+
+ModularBigInteger ModularBigInteger::sqrt() const {
+    const Montgomery *context = contextOf(modulus);
+    if (context == nullptr) {
+        throw std::invalid_argument("Error: ModularBigInteger: square roots need an odd prime modulus");
+    }
+
+    ModularBigInteger result(*this);
+    result.value = FieldElement(value, context).sqrt().toUnsigned();
+
+    return result;
+}
+
+
+void ModularBigInteger::batchInvert(std::span<ModularBigInteger> values) {
+    if (values.empty()) {
+        return;
+    }
+
+    std::vector<ModularBigInteger> prefixes(values.size());
+    prefixes[0] = values[0];
+    for (size_t i = 1; i < values.size(); ++i) {
+        if (values[i].modulus != values[0].modulus) {
+            throw std::invalid_argument("Error: ModularBigInteger: batch inversion needs a common modulus");
+        }
+
+        prefixes[i] = prefixes[i - 1] * values[i];
+    }
+
+    // The product is invertible if and only if every value is
+    ModularBigInteger inverse(prefixes.back());
+    inverse.value = Inversion::binary(prefixes.back().value, prefixes.back().modulus);
+
+    for (size_t i = values.size() - 1; i > 0; --i) {
+        const ModularBigInteger value = values[i];
+        values[i] = inverse * prefixes[i - 1];
+        inverse *= value;
+    }
+    values[0] = inverse;
+}
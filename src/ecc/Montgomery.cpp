@@ -1,16 +1,96 @@
+#include <map>
+#include <memory>
+#include <mutex>
 #include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/Exponentiation.h"
 
 using namespace ecc;
 
 
+namespace {
+    /**
+     * Final step of the Montgomery reductions: t (limbs digits, plus an extra top digit) is lower than 2 * modulus,
+     * subtract the modulus once and keep the difference if it did not underflow, without branching.
+     */
+    void finalSubtraction(Digit *result, const Digit *t, Digit extra, const Digit *modulus, size_t limbs) {
+        DoubleDigit borrow = 0;
+        for (size_t j = 0; j < limbs; ++j) {
+            borrow = static_cast<DoubleDigit>(t[j]) - modulus[j] - borrow;
+            result[j] = static_cast<Digit>(borrow);
+            borrow = (borrow >> UnsignedBigInteger::BITS) & 1;
+        }
+
+        // Keep the difference when t had an extra digit or when the subtraction did not borrow
+        const Digit keep = -static_cast<Digit>(extra | (borrow ^ 1));
+        for (size_t j = 0; j < limbs; ++j) {
+            result[j] = (result[j] & keep) | (t[j] & ~keep);
+        }
+    }
+}
+
+
 Montgomery::Montgomery(const UnsignedBigInteger &pModulus) {
+    if ((pModulus.digits[0] & 1) == 0) {
+        throw std::invalid_argument("Error: Montgomery: modulus must be odd");
+    }
+
     modulus = pModulus;
-    reducerBits = pModulus.getMostSignificantBitIndex();
+    limbs = pModulus.digits.size();
+    reducerBits = limbs * UnsignedBigInteger::BITS;
     r = UnsignedBigInteger(1) << reducerBits;
-    invR = knuthModularInverse(r, modulus);
-    invN = knuthModularInverse(modulus, r);
-    invN = (r + r - invN) % r;
+    invR = knuthModularInverse(r % modulus, modulus);
+
+    // Newton iteration on the lowest digit: each step doubles the number of correct bits of modulus^-1 mod 2^BITS
+    Digit inverse = modulus.digits[0]; // Correct on 3 bits, since x * x = 1 mod 8 for any odd x
+    for (size_t bits = 3; bits < UnsignedBigInteger::BITS; bits *= 2) {
+        inverse *= 2 - modulus.digits[0] * inverse;
+    }
+    invN = -inverse;
+
     r2modN = r * r % modulus; // Precompute r² mod modulus
+
+    if (limbs <= FIELD_LIMBS) {
+        fixedModulus = Value(modulus);
+        fixedOne = Value(r % modulus);
+        fixedInverseFactor = Value(r2modN * r % modulus); // (a r)^-1 * r^3 * r^-1 = a^-1 r
+    }
+}
+
+
+void Montgomery::multiply(Value &result, const Value &a, const Value &b) const {
+    Digit scratch[FIELD_LIMBS + 2];
+    multiply(result.digits.data(), a.digits.data(), b.digits.data(), fixedModulus.digits.data(), invN, limbs, scratch);
+}
+
+
+void Montgomery::square(Value &result, const Value &a) const {
+    Digit scratch[2 * FIELD_LIMBS];
+    square(result.digits.data(), a.digits.data(), fixedModulus.digits.data(), invN, limbs, scratch);
+}
+
+
+Field::Value Montgomery::encode(const UnsignedBigInteger &a) const {
+    return Value(toMontgomery(a));
+}
+
+
+UnsignedBigInteger Montgomery::decode(const Value &a) const {
+    return fromMontgomery(a.toUnsigned());
+}
+
+
+const Montgomery *Montgomery::forModulus(const UnsignedBigInteger &pModulus) {
+    static std::mutex mutex;
+    static std::map<Digits, std::unique_ptr<const Montgomery>> contexts;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    DigitResourceScope heap(nullptr); // The contexts outlive the resource of the caller
+    std::unique_ptr<const Montgomery> &context = contexts[pModulus.digits];
+    if (!context) {
+        context = std::make_unique<const Montgomery>(pModulus);
+    }
+
+    return context.get();
 }
 
 
@@ -19,35 +99,196 @@ UnsignedBigInteger Montgomery::montgomeryRef(const UnsignedBigInteger &a, const
 }
 
 UnsignedBigInteger Montgomery::montgomery(const UnsignedBigInteger &a, const UnsignedBigInteger &b) const {
-    UnsignedBigInteger T = a * b;
-    UnsignedBigInteger m = modR(modR(T) * invN);
-    UnsignedBigInteger t = divR(T + m * modulus);
-
-    if (t >= modulus) {
-        return t - modulus;
-    } else {
-        return t;
+    UnsignedBigInteger result;
+    Digits scratch;
+    montgomery(result, a, b, scratch);
+
+    return result;
+}
+
+void Montgomery::montgomery(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b,
+                            Digits &scratch) const {
+    if (a.digits.size() > limbs || b.digits.size() > limbs) {
+        montgomery(out, a % modulus, b % modulus, scratch); // The buffers are sized on the modulus
+        return;
     }
+
+    // The operands are copied first, so that out may alias them
+    scratch.resize(3 * limbs + 2);
+    Digit *paddedA = scratch.data(), *paddedB = paddedA + limbs;
+    std::fill(std::copy(a.digits.begin(), a.digits.end(), paddedA), paddedA + limbs, 0);
+    std::fill(std::copy(b.digits.begin(), b.digits.end(), paddedB), paddedB + limbs, 0);
+
+    multiply(paddedA, paddedA, paddedB, modulus.digits.data(), invN, limbs, paddedB + limbs);
+
+    out.digits.assign(paddedA, paddedA + limbs);
+    out.trim();
+}
+
+void Montgomery::multiply(
+        Digit *result,
+        const Digit *a,
+        const Digit *b,
+        const Digit *modulus,
+        Digit invN,
+        size_t limbs,
+        Digit *scratch
+) {
+    Digit *t = scratch;
+    std::fill(t, t + limbs + 2, 0);
+
+    for (size_t i = 0; i < limbs; ++i) {
+        // t += a * b[i]
+        DoubleDigit carry = 0;
+        for (size_t j = 0; j < limbs; ++j) {
+            carry += static_cast<DoubleDigit>(a[j]) * b[i] + t[j];
+            t[j] = static_cast<Digit>(carry);
+            carry >>= UnsignedBigInteger::BITS;
+        }
+        carry += t[limbs];
+        t[limbs] = static_cast<Digit>(carry);
+        t[limbs + 1] = static_cast<Digit>(carry >> UnsignedBigInteger::BITS);
+
+        // t = (t + m * modulus) / 2^BITS, where m is chosen so that the lowest digit vanishes
+        const Digit m = t[0] * invN;
+        carry = (static_cast<DoubleDigit>(m) * modulus[0] + t[0]) >> UnsignedBigInteger::BITS;
+        for (size_t j = 1; j < limbs; ++j) {
+            carry += static_cast<DoubleDigit>(m) * modulus[j] + t[j];
+            t[j - 1] = static_cast<Digit>(carry);
+            carry >>= UnsignedBigInteger::BITS;
+        }
+        carry += t[limbs];
+        t[limbs - 1] = static_cast<Digit>(carry);
+        t[limbs] = t[limbs + 1] + static_cast<Digit>(carry >> UnsignedBigInteger::BITS);
+    }
+
+    finalSubtraction(result, t, t[limbs], modulus, limbs);
+}
+
+void Montgomery::square(
+        Digit *result,
+        const Digit *a,
+        const Digit *modulus,
+        Digit invN,
+        size_t limbs,
+        Digit *scratch
+) {
+    Digit *t = scratch;
+    std::fill(t, t + 2 * limbs, 0);
+
+    // Cross products a[i]*a[j] with i < j, computed once
+    for (size_t i = 0; i < limbs; ++i) {
+        DoubleDigit carry = 0;
+        for (size_t j = i + 1; j < limbs; ++j) {
+            carry += static_cast<DoubleDigit>(a[i]) * a[j] + t[i + j];
+            t[i + j] = static_cast<Digit>(carry);
+            carry >>= UnsignedBigInteger::BITS;
+        }
+        t[i + limbs] = static_cast<Digit>(carry);
+    }
+
+    // Double the cross products and add the squares a[i]*a[i] on the diagonal
+    Digit shifted = 0;
+    DoubleDigit carry = 0;
+    for (size_t i = 0; i < limbs; ++i) {
+        const DoubleDigit diagonal = static_cast<DoubleDigit>(a[i]) * a[i];
+        const Digit low = t[2 * i], high = t[2 * i + 1];
+
+        carry += static_cast<DoubleDigit>(static_cast<Digit>(low << 1 | shifted)) + static_cast<Digit>(diagonal);
+        t[2 * i] = static_cast<Digit>(carry);
+        carry >>= UnsignedBigInteger::BITS;
+        carry += static_cast<DoubleDigit>(static_cast<Digit>(high << 1 | low >> (UnsignedBigInteger::BITS - 1)))
+                 + static_cast<Digit>(diagonal >> UnsignedBigInteger::BITS);
+        t[2 * i + 1] = static_cast<Digit>(carry);
+        carry >>= UnsignedBigInteger::BITS;
+        shifted = high >> (UnsignedBigInteger::BITS - 1);
+    }
+
+    // Reduce digit per digit: each step clears t[i] by adding a multiple of the modulus
+    Digit overflow = 0;
+    for (size_t i = 0; i < limbs; ++i) {
+        const Digit m = t[i] * invN;
+        carry = 0;
+        for (size_t j = 0; j < limbs; ++j) {
+            carry += static_cast<DoubleDigit>(m) * modulus[j] + t[i + j];
+            t[i + j] = static_cast<Digit>(carry);
+            carry >>= UnsignedBigInteger::BITS;
+        }
+        carry += static_cast<DoubleDigit>(t[i + limbs]) + overflow;
+        t[i + limbs] = static_cast<Digit>(carry);
+        overflow = static_cast<Digit>(carry >> UnsignedBigInteger::BITS);
+    }
+
+    finalSubtraction(result, t + limbs, overflow, modulus, limbs);
+}
+
+UnsignedBigInteger Montgomery::montgomerySquare(const UnsignedBigInteger &a) const {
+    if (a.digits.size() > limbs) {
+        return montgomerySquare(a % modulus);
+    }
+
+    Digits paddedA(a.digits), scratch(2 * limbs);
+    paddedA.resize(limbs, 0);
+
+    square(paddedA.data(), paddedA.data(), modulus.digits.data(), invN, limbs, scratch.data());
+
+    return UnsignedBigInteger(paddedA);
 }
 
 UnsignedBigInteger Montgomery::multiplication(const UnsignedBigInteger &a, const UnsignedBigInteger &b) const {
-    UnsignedBigInteger phyA = montgomery(a, r2modN);
-    UnsignedBigInteger phyB = montgomery(b, r2modN);
-    UnsignedBigInteger phyC = montgomery(phyA, phyB);
-    UnsignedBigInteger c = montgomery(phyC, 1);
-    return c;
+    UnsignedBigInteger result;
+    Digits scratch;
+    multiplication(result, a, b, scratch);
+
+    return result;
 }
 
-UnsignedBigInteger Montgomery::modR(const UnsignedBigInteger &in) const {
-    return in & UnsignedBigInteger(r - 1);
+void Montgomery::multiplication(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b,
+                                Digits &scratch) const {
+    if (!(a < modulus) || !(b < modulus)) {
+        multiplication(out, a % modulus, b % modulus, scratch);
+        return;
+    }
+
+    // (a * b * r^-1) * r^2 * r^-1 = a * b
+    montgomery(out, a, b, scratch);
+    montgomery(out, out, r2modN, scratch);
 }
 
+UnsignedBigInteger Montgomery::toMontgomery(const UnsignedBigInteger &a) const {
+    return montgomery(a < modulus ? a : a % modulus, r2modN);
+}
 
-UnsignedBigInteger Montgomery::divR(const UnsignedBigInteger &in) const {
-    return in >> (r.getMostSignificantBitIndex() - 1);
+UnsignedBigInteger Montgomery::fromMontgomery(const UnsignedBigInteger &a) const {
+    return montgomery(a, 1);
 }
 
 
+UnsignedBigInteger Montgomery::pow(const UnsignedBigInteger &base, const UnsignedBigInteger &exponent) const {
+    if (limbs <= FIELD_LIMBS) {
+        return Exponentiation::slidingWindow(FieldElement(base, this), exponent).toUnsigned();
+    }
+
+    const UnsignedBigInteger result = Exponentiation::slidingWindow(
+            toMontgomery(base),
+            toMontgomery(1),
+            exponent,
+            [this](const UnsignedBigInteger &a, const UnsignedBigInteger &b) { return montgomery(a, b); },
+            [this](const UnsignedBigInteger &a) { return montgomerySquare(a); }
+    );
+    return fromMontgomery(result);
+}
+
+
+UnsignedBigInteger Montgomery::powConstantTime(const UnsignedBigInteger &base,
+                                               const UnsignedBigInteger &exponent) const {
+    if (limbs > FIELD_LIMBS) {
+        throw std::invalid_argument("Error: Montgomery: modulus is too large for the constant-time exponentiation");
+    }
+
+    return Exponentiation::fixedWindow(FieldElement(base, this), exponent, reducerBits).toUnsigned();
+}
+
 UnsignedBigInteger Montgomery::knuthModularInverse(const UnsignedBigInteger &in, const UnsignedBigInteger &mod) {
     UnsignedBigInteger inv, u1, u3, v1, v3, t1, t3, q;
     int iter;
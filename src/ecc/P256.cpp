@@ -1,2 +1,46 @@
+#include <mutex>
 #include "../../includes/ecc/P256.h"
 
+using namespace ecc;
+
+static std::mutex generatorTableMutex;
+static std::shared_ptr<const FixedBaseTable> generatorTableInstance;
+
+static const std::string mod = "115792089210356248762697446949407573530086143415290314195533631308867097853951";
+
+UnsignedBigInteger P256::m(mod);
+UnsignedBigInteger P256::n("115792089210356248762697446949407573529996955224135760342422259061068512044369");
+const Field *P256::context = P256Field::instance();
+ModularBigInteger P256::a("115792089210356248762697446949407573530086143415290314195533631308867097853948", mod);
+ModularBigInteger P256::b("41058363725152142129326129780047268409114441015993725554835256314039467401291", mod);
+Point P256::generator(
+        UnsignedBigInteger("48439561293906451759052585252797914202762949526041747995844080717082404635286"),
+        UnsignedBigInteger("36134250956749795798585127919587881956611106672985015071877198253568414405109"),
+        UnsignedBigInteger("1"),
+        P256::a.value,
+        P256::b.value,
+        P256::context
+);
+
+
+std::shared_ptr<const FixedBaseTable> P256::generatorTable() {
+    std::lock_guard<std::mutex> lock(generatorTableMutex);
+
+    if (!generatorTableInstance) {
+        DigitResourceScope heap(nullptr); // The table outlives the resource of the caller
+        generatorTableInstance = std::make_shared<const FixedBaseTable>(generator, n.getMostSignificantBitIndex());
+    }
+
+    return generatorTableInstance;
+}
+
+
+void P256::setGeneratorTable(std::shared_ptr<const FixedBaseTable> table) {
+    std::lock_guard<std::mutex> lock(generatorTableMutex);
+    generatorTableInstance = std::move(table);
+}
+
+
+Point P256::multiplyGenerator(const UnsignedBigInteger &k) {
+    return generatorTable()->multiply(k);
+}
@@ -0,0 +1,126 @@
+#include "../../includes/ecc/P256Field.h"
+#include "../../includes/ecc/DigitResource.h"
+
+using namespace ecc;
+
+static_assert(Field::FIELD_LIMBS * UnsignedBigInteger::BITS >= 256, "P256Field requires ECC_FIELD_BITS >= 256");
+
+
+namespace {
+    const unsigned WORDS_PER_DIGIT = UnsignedBigInteger::BITS / 32;
+    const size_t DIGITS_256 = 256 / UnsignedBigInteger::BITS;
+
+
+    /**
+     * Propagate the signed carries of the 32-bit word accumulators, and return the (signed) outgoing carry.
+     */
+    int64_t propagate(int64_t *accumulators, uint32_t *words) {
+        int64_t carry = 0;
+
+        for (size_t i = 0; i < 8; ++i) {
+            accumulators[i] += carry;
+            words[i] = static_cast<uint32_t>(accumulators[i]);
+            carry = accumulators[i] >> 32;
+        }
+
+        return carry;
+    }
+
+
+    /**
+     * Reduce modulo 2^256, when ECC_FIELD_BITS is larger than 256.
+     */
+    void truncate(Field::Value &value) {
+        for (size_t j = DIGITS_256; j < Field::FIELD_LIMBS; ++j) {
+            value.digits[j] = 0;
+        }
+    }
+}
+
+
+P256Field::P256Field() {
+    modulus = UnsignedBigInteger("115792089210356248762697446949407573530086143415290314195533631308867097853951");
+    limbs = modulus.digits.size();
+    fixedModulus = Value(modulus);
+    fixedOne = Value(1);
+    fixedInverseFactor = Value(1);
+}
+
+
+const P256Field *P256Field::instance() {
+    static const P256Field field = [] {
+        DigitResourceScope heap(nullptr); // The field outlives the resource of the caller
+        return P256Field();
+    }();
+    return &field;
+}
+
+
+void P256Field::multiply(Value &result, const Value &a, const Value &b) const {
+    result = reduce(a * b);
+}
+
+
+void P256Field::square(Value &result, const Value &a) const {
+    result = reduce(a * a);
+}
+
+
+Field::Value P256Field::encode(const UnsignedBigInteger &a) const {
+    return Value(a % modulus);
+}
+
+
+UnsignedBigInteger P256Field::decode(const Value &a) const {
+    return a.toUnsigned();
+}
+
+
+Field::Value P256Field::reduce(const FixedUnsignedInteger<2 * FIELD_LIMBS> &product) const {
+    // The product as 16 words c0..c15
+    int64_t c[16];
+    for (size_t i = 0; i < 16; ++i) {
+        c[i] = static_cast<uint32_t>(product.digits[i / WORDS_PER_DIGIT] >> (32 * (i % WORDS_PER_DIGIT)));
+    }
+
+    // s1 + 2 s2 + 2 s3 + s4 + s5 - d1 - d2 - d3 - d4, word per word
+    int64_t accumulators[8] = {
+            c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14],
+            c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15],
+            c[2] + c[10] + c[11] - c[13] - c[14] - c[15],
+            c[3] + 2 * (c[11] + c[12]) + c[13] - c[15] - c[8] - c[9],
+            c[4] + 2 * (c[12] + c[13]) + c[14] - c[9] - c[10],
+            c[5] + 2 * (c[13] + c[14]) + c[15] - c[10] - c[11],
+            c[6] + 3 * c[14] + 2 * c[15] + c[13] - c[8] - c[9],
+            c[7] + 3 * c[15] + c[8] - c[10] - c[11] - c[12] - c[13]
+    };
+    uint32_t words[8];
+    int64_t carry = propagate(accumulators, words); // In [-4, 6]
+
+    // Fold the carry back with 2^256 = 2^224 - 2^192 - 2^96 + 1 (mod p), the new carry is in [-1, 1]
+    int64_t folded[8] = {
+            words[0] + carry, words[1], words[2], words[3] - carry, words[4], words[5], words[6] - carry,
+            words[7] + carry
+    };
+    carry = propagate(folded, words);
+
+    Value t;
+    for (size_t i = 0; i < 8; ++i) {
+        t.digits[i / WORDS_PER_DIGIT] |= static_cast<Digit>(words[i]) << (32 * (i % WORDS_PER_DIGIT));
+    }
+
+    // Remove the carry by adding or subtracting p once (modulo 2^256), then do the usual final subtraction
+    Value corrected(t);
+    corrected.add(fixedModulus);
+    truncate(corrected);
+    t.conditionalAssign(corrected, static_cast<Digit>(carry < 0));
+    corrected = t;
+    corrected.subtract(fixedModulus);
+    truncate(corrected);
+    t.conditionalAssign(corrected, static_cast<Digit>(carry > 0));
+    corrected = t;
+    const Digit borrow = corrected.subtract(fixedModulus);
+    t.conditionalAssign(corrected, borrow ^ 1);
+
+    return t;
+}
@@ -1,7 +1,25 @@
 #include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/JacobianPoint.h"
+#include "../../includes/ecc/Exponentiation.h"
 
 using namespace ecc;
 
+
+namespace {
+    /**
+     * Bring a point at infinity (0:y:0 on the curve, but any z = 0 point may be given) to the (0:1:0) form of the
+     * complete formulas, with masked assignments so that the ladder does not branch on its intermediate points.
+     */
+    Point withCanonicalInfinity(const Point &point) {
+        Point canonical(point);
+        const Digit atInfinity = static_cast<Digit>(point.z.isZero());
+        canonical.x.value.conditionalAssign(FieldElement::Value(), atInfinity);
+        canonical.y.value.conditionalAssign(point.curve->field->fixedOne, atInfinity);
+        return canonical;
+    }
+}
+
+
 Point::Point(
         const UnsignedBigInteger &pX,
         const UnsignedBigInteger &pY,
@@ -9,46 +27,77 @@ Point::Point(
         const UnsignedBigInteger &pA,
         const UnsignedBigInteger &pB,
         const UnsignedBigInteger &pM
+) : Point(pX, pY, pZ, Curve::forParameters(pA, pB, pM)) {}
+
+
+Point::Point(
+        const UnsignedBigInteger &pX,
+        const UnsignedBigInteger &pY,
+        const UnsignedBigInteger &pZ,
+        const UnsignedBigInteger &pA,
+        const UnsignedBigInteger &pB,
+        const Field *pField
+) : Point(pX, pY, pZ, Curve::forParameters(pA, pB, pField)) {}
+
+
+Point::Point(
+        const UnsignedBigInteger &pX,
+        const UnsignedBigInteger &pY,
+        const UnsignedBigInteger &pZ,
+        const Curve *pCurve
 ) {
-    m = pM;
-    x = ModularBigInteger(pX, pM);
-    y = ModularBigInteger(pX, pM);
-    z = ModularBigInteger(pX, pM);
-    a = ModularBigInteger(pA, pM);
-    b = ModularBigInteger(pB, pM);
+    curve = pCurve;
+    x = FieldElement(pX, curve->field);
+    y = FieldElement(pY, curve->field);
+    z = FieldElement(pZ, curve->field);
 }
 
 
 bool Point::isZero() const {
-    return x.value == 0;
+    return z.isZero();
 }
 
-Point Point::factory(const ModularBigInteger &pX, const ModularBigInteger &pY, const ModularBigInteger &pZ) const {
+Point Point::factory(const FieldElement &pX, const FieldElement &pY, const FieldElement &pZ) const {
     Point build;
+    build.curve = curve;
     build.x = pX;
     build.y = pY;
     build.z = pZ;
-    build.a = a;
-    build.b = b;
-    build.m = m;
     return build;
 }
 
-Point Point::twice() const {
-    if (isZero() || y.value == 0) {
-        return Point(0, 0, 0, a.value, b.value, m);
+Point Point::infinity(const Curve *pCurve) {
+    Point build;
+    if (pCurve == nullptr) {
+        return build;
     }
 
-    ModularBigInteger two(2, m);
-    ModularBigInteger three(3, m);
+    build.curve = pCurve;
+    build.x = FieldElement::fromValue(FieldElement::Value(), pCurve->field);
+    build.y = FieldElement::fromValue(pCurve->field->fixedOne, pCurve->field);
+    build.z = build.x;
+    return build;
+}
+
+Point Point::twice() const {
+    if (isZero()) {
+        return *this;
+    } else if (y.isZero()) {
+        return infinity(curve);
+    }
 
-    ModularBigInteger t = x * x * three + a * z * z;
-    ModularBigInteger u = y * z * two;
-    ModularBigInteger v = u * x * y * two;
-    ModularBigInteger w = t * t - v * two;
-    ModularBigInteger rx = u * w;
-    ModularBigInteger ry = t * (v - w) - u * u * y * y * two;
-    ModularBigInteger rz = u * u * u;
+    // Small constants are applied with additions, which are much cheaper than field multiplications
+    FieldElement xx = x.square();
+    FieldElement yz = y * z;
+    FieldElement t = xx + xx + xx + curve->a * z.square();
+    FieldElement u = yz + yz;
+    FieldElement uxy = u * x * y;
+    FieldElement v = uxy + uxy;
+    FieldElement w = t.square() - v - v;
+    FieldElement uy2 = (u * y).square();
+    FieldElement rx = u * w;
+    FieldElement ry = t * (v - w) - uy2 - uy2;
+    FieldElement rz = u.square() * u;
 
     return factory(rx, ry, rz);
 }
@@ -67,10 +116,10 @@ Point &Point::operator+=(const Point &other) {
         return *this;
     }
 
-    ModularBigInteger t0 = y * other.z;
-    ModularBigInteger t1 = other.y * z;
-    ModularBigInteger u0 = x * other.z;
-    ModularBigInteger u1 = other.x * z;
+    FieldElement t0 = y * other.z;
+    FieldElement t1 = other.y * z;
+    FieldElement u0 = x * other.z;
+    FieldElement u1 = other.x * z;
 
 
     if (u0 == u1) {
@@ -79,21 +128,21 @@ Point &Point::operator+=(const Point &other) {
             *this = twice();
             return *this;
         } else {
-            *this = Point(0, 0, 0, a.value, b.value, m);
+            *this = infinity(curve);
             return *this;
         }
     }
 
     // Finish the computation of the projective variables
-    ModularBigInteger t = t0 - t1;
-    ModularBigInteger u = u0 - u1;
-    ModularBigInteger u2 = u * u;
-    ModularBigInteger v = z * other.z;
-    ModularBigInteger w = t * t * v - u2 * (u0 + u1);
-    ModularBigInteger u3 = u * u2;
-    ModularBigInteger rx = u * w;
-    ModularBigInteger ry = t * (u0 * u2 - w) - t0 * u3;
-    ModularBigInteger rz = u3 * v;
+    FieldElement t = t0 - t1;
+    FieldElement u = u0 - u1;
+    FieldElement u2 = u.square();
+    FieldElement v = z * other.z;
+    FieldElement w = t.square() * v - u2 * (u0 + u1);
+    FieldElement u3 = u * u2;
+    FieldElement rx = u * w;
+    FieldElement ry = t * (u0 * u2 - w) - t0 * u3;
+    FieldElement rz = u3 * v;
     *this = factory(rx, ry, rz);
     return *this;
 }
@@ -104,10 +153,8 @@ bool Point::operator==(const Point &other) const {
     }
 
     return (x * other.z == other.x * z)
-           && (y * other.z == other.x * z)
-           && a == other.a
-           && b == other.b
-           && m == other.m;
+           && (y * other.z == other.y * z)
+           && curve == other.curve;
 }
 
 bool Point::operator!=(const Point &other) const {
@@ -115,7 +162,12 @@ bool Point::operator!=(const Point &other) const {
 }
 
 bool Point::isOnCurve() const {
-    return !isZero() && y * y * z == x * x * x + a * x * z * z + b * z * z * z;
+    if (isZero()) {
+        return false; // The point at infinity may not be bound to a curve
+    }
+
+    FieldElement zz = z.square();
+    return y.square() * z == x.square() * x + curve->a * x * zz + curve->b * zz * z;
 }
 
 Point Point::operator-(const Point &other) const {
@@ -125,9 +177,13 @@ Point Point::operator-(const Point &other) const {
 }
 
 Point &Point::operator-=(const Point &other) {
+    if (other.isZero()) {
+        return *this; // Which may not be bound to a curve, and has no y to negate
+    }
+
     // Negate "other"
     Point otherCopy(other);
-    otherCopy.y.value = m - other.y.value;
+    otherCopy.y = -other.y;
 
     *this += otherCopy;
     return *this;
@@ -140,21 +196,227 @@ Point Point::operator*(const UnsignedBigInteger &other) const {
 }
 
 Point &Point::operator*=(const UnsignedBigInteger &p) {
-    UnsignedBigInteger n(p);
-    Point result;
-    Point temp(*this);
-    UnsignedBigInteger one(1);
-
-    while (n != 0) {
-        UnsignedBigInteger nAndOne = n & one;
-        if (nAndOne != one) {
-            result += temp;
+    // Jacobian coordinates have cheaper doublings and additions, and no inversion is needed to convert back
+    *this = (JacobianPoint(*this) * p).toPoint();
+    return *this;
+}
+
+Point Point::multiScalarMul(std::span<const Point> points, std::span<const UnsignedBigInteger> scalars) {
+    if (points.size() != scalars.size()) {
+        throw std::invalid_argument("Error: Point: multiScalarMul needs as many points as scalars");
+    }
+
+    if (points.empty()) {
+        return Point();
+    } else if (points.size() == 1) {
+        return points[0] * scalars[0];
+    }
+
+    std::vector<JacobianPoint> jacobianPoints(points.begin(), points.end());
+
+    if (points.size() < PIPPENGER_THRESHOLD) {
+        return JacobianPoint::interleavedWnaf(jacobianPoints, scalars).toPoint();
+    }
+
+    return JacobianPoint::pippenger(jacobianPoints, scalars).toPoint();
+}
+
+
+Point Point::completeAdd(const Point &other) const {
+    // The unbound point at infinity takes the curve of the other operand
+    if (other.curve == nullptr) {
+        return curve == nullptr ? *this : completeAdd(infinity(curve));
+    } else if (curve == nullptr) {
+        return infinity(other.curve).completeAdd(other);
+    }
+
+    const FieldElement &a = curve->a, &b3 = curve->b3;
+    const Point p = withCanonicalInfinity(*this), q = withCanonicalInfinity(other);
+
+    FieldElement t0 = p.x * q.x;
+    FieldElement t1 = p.y * q.y;
+    FieldElement t2 = p.z * q.z;
+    FieldElement t3 = (p.x + p.y) * (q.x + q.y);
+    FieldElement t4 = t0 + t1;
+    t3 -= t4;
+    t4 = (p.x + p.z) * (q.x + q.z);
+    FieldElement t5 = t0 + t2;
+    t4 -= t5;
+    t5 = (p.y + p.z) * (q.y + q.z);
+    FieldElement rx = t1 + t2;
+    t5 -= rx;
+    FieldElement rz = a * t4;
+    rx = b3 * t2;
+    rz += rx;
+    rx = t1 - rz;
+    rz += t1;
+    FieldElement ry = rx * rz;
+    t1 = t0 + t0 + t0;
+    t2 = a * t2;
+    t4 = b3 * t4;
+    t1 += t2;
+    t2 = a * (t0 - t2);
+    t4 += t2;
+    ry += t1 * t4;
+    rx = t3 * rx - t5 * t4;
+    rz = t5 * rz + t3 * t1;
+
+    return factory(rx, ry, rz);
+}
+
+
+Point Point::ladder(const UnsignedBigInteger &k) const {
+    if (isZero()) {
+        return infinity(curve); // The point is public, unlike the scalar
+    }
+
+    // The scalar is read from fixed-size digits, its length does not leak through the loop bounds
+    const FieldElement::Value scalar(k);
+    const FieldElement zero = FieldElement::fromValue(FieldElement::Value(), curve->field);
+    Point r0 = factory(zero, FieldElement::fromValue(curve->field->fixedOne, curve->field), zero);
+    Point r1 = *this;
+
+    // Invariant: r1 = r0 + P
+    for (size_t bitIndex = Field::FIELD_LIMBS * UnsignedBigInteger::BITS; bitIndex-- != 0;) {
+        const Digit bit = scalar.getBit(bitIndex);
+
+        conditionalSwap(r0, r1, bit);
+        r1 = r0.completeAdd(r1);
+        r0 = r0.completeAdd(r0);
+        conditionalSwap(r0, r1, bit);
+    }
+
+    return r0;
+}
+
+
+void Point::conditionalSwap(Point &first, Point &second, Digit condition) {
+    FieldElement::conditionalSwap(first.x, second.x, condition);
+    FieldElement::conditionalSwap(first.y, second.y, condition);
+    FieldElement::conditionalSwap(first.z, second.z, condition);
+}
+
+
+Point Point::normalize() const {
+    if (isZero()) {
+        return *this;
+    }
+
+    FieldElement invZ = z.inverse();
+    return factory(x * invZ, y * invZ, FieldElement::fromValue(curve->field->fixedOne, curve->field));
+}
+
+void Point::normalize(std::vector<Point> &points) {
+    std::vector<size_t> indexes;
+    std::vector<FieldElement> inverses;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].isZero()) {
+            indexes.push_back(i);
+            inverses.push_back(points[i].z);
         }
+    }
 
-        temp = temp.twice();
-        n >>= 1;
+    FieldElement::batchInvert(inverses);
+    for (size_t t = 0; t < indexes.size(); ++t) {
+        Point &point = points[indexes[t]];
+        point = point.factory(point.x * inverses[t], point.y * inverses[t],
+                              FieldElement::fromValue(point.curve->field->fixedOne, point.curve->field));
     }
+}
 
-    *this = result;
-    return *this;
+size_t Point::encodedSize(const Curve *pCurve, bool compressed) {
+    const size_t coordinateBytes = (pCurve->field->modulus.getMostSignificantBitIndex() + 7) / 8;
+    return 1 + (compressed ? 1 : 2) * coordinateBytes;
+}
+
+size_t Point::encode(std::span<uint8_t> output, bool compressed) const {
+    const size_t size = isZero() ? 1 : encodedSize(curve, compressed);
+    if (output.size() < size) {
+        throw std::overflow_error("Error: Point: output is too short for the encoding");
+    }
+
+    if (isZero()) {
+        output[0] = 0x00;
+        return size;
+    }
+
+    const Point affine = normalize();
+    const size_t coordinateBytes = encodedSize(curve, true) - 1;
+    const UnsignedBigInteger y = affine.y.toUnsigned();
+    affine.x.toUnsigned().toBytes(output.subspan(1, coordinateBytes));
+
+    if (compressed) {
+        output[0] = 0x02 | y.getBit(0);
+    } else {
+        output[0] = 0x04;
+        y.toBytes(output.subspan(1 + coordinateBytes, coordinateBytes));
+    }
+
+    return size;
+}
+
+std::vector<uint8_t> Point::compress() const {
+    std::vector<uint8_t> encoded(isZero() ? 1 : encodedSize(curve, true));
+    encode(encoded, true);
+
+    return encoded;
+}
+
+Point Point::decompress(std::span<const uint8_t> encoded, const Curve *pCurve) {
+    const Field *field = pCurve->field;
+    if (encoded.size() == 1 && encoded[0] == 0x00) {
+        return Point(UnsignedBigInteger(0), UnsignedBigInteger(1), UnsignedBigInteger(0), pCurve);
+    }
+
+    if (encoded.size() != encodedSize(pCurve, true) || (encoded[0] != 0x02 && encoded[0] != 0x03)) {
+        throw std::invalid_argument("Error: Point: invalid compressed encoding");
+    }
+
+    const UnsignedBigInteger x = UnsignedBigInteger::fromBytes(encoded.subspan(1));
+    if (x >= field->modulus) {
+        throw std::invalid_argument("Error: Point: abscissa is not reduced");
+    }
+
+    const FieldElement fx(x, field);
+    const FieldElement rhs = fx.square() * fx + pCurve->a * fx + pCurve->b;
+    const FieldElement fy = Exponentiation::squareRoot(rhs);
+    if (fy.square() != rhs) {
+        throw std::invalid_argument("Error: Point: abscissa is not on the curve");
+    }
+
+    // Pick the root of the encoded parity, which does not exist for y = 0 and an odd prefix
+    UnsignedBigInteger y = fy.toUnsigned();
+    if (y.getBit(0) != (encoded[0] & 1)) {
+        y = (field->modulus - y) % field->modulus;
+        if (y.getBit(0) != (encoded[0] & 1)) {
+            throw std::invalid_argument("Error: Point: invalid compressed encoding");
+        }
+    }
+
+    return Point(x, y, UnsignedBigInteger(1), pCurve);
+}
+
+Point Point::decode(std::span<const uint8_t> encoded, const Curve *pCurve) {
+    if (encoded.empty() || encoded[0] != 0x04) {
+        return decompress(encoded, pCurve);
+    }
+
+    const Field *field = pCurve->field;
+    const size_t coordinateBytes = encodedSize(pCurve, true) - 1;
+    if (encoded.size() != encodedSize(pCurve, false)) {
+        throw std::invalid_argument("Error: Point: invalid uncompressed encoding");
+    }
+
+    const UnsignedBigInteger x = UnsignedBigInteger::fromBytes(encoded.subspan(1, coordinateBytes));
+    const UnsignedBigInteger y = UnsignedBigInteger::fromBytes(encoded.last(coordinateBytes));
+    if (x >= field->modulus || y >= field->modulus) {
+        throw std::invalid_argument("Error: Point: coordinates are not reduced");
+    }
+
+    const Point point(x, y, UnsignedBigInteger(1), pCurve);
+    if (!point.isOnCurve()) {
+        throw std::invalid_argument("Error: Point: point is not on the curve");
+    }
+
+    return point;
 }
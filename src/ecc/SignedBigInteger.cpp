@@ -71,7 +71,7 @@ SignedBigInteger::SignedBigInteger(const std::string &str) {
  * ======================================================================
  */
 SignedBigInteger &SignedBigInteger::operator=(uint32_t unsignedDigit) {
-    *this = SignedBigInteger(unsignedDigit);
+    *this = SignedBigInteger(static_cast<Digit>(unsignedDigit));
 
     return *this;
 }
@@ -1,8 +1,300 @@
+#include <array>
+#include <deque>
 #include "../../includes/ecc/UnsignedBigInteger.h"
 
 using namespace ecc;
 
 
+namespace {
+    /**
+     * Sign-magnitude value used by the Toom-3 evaluation and interpolation, where intermediate values may be negative.
+     */
+    struct ToomValue {
+        UnsignedBigInteger magnitude;
+        bool negative;
+    };
+
+
+    ToomValue toomAdd(const ToomValue &a, const ToomValue &b) {
+        if (a.negative == b.negative) {
+            return {a.magnitude + b.magnitude, a.negative};
+        } else if (a.magnitude >= b.magnitude) {
+            return {a.magnitude - b.magnitude, a.negative};
+        } else {
+            return {b.magnitude - a.magnitude, b.negative};
+        }
+    }
+
+
+    ToomValue toomSubtract(const ToomValue &a, const ToomValue &b) {
+        return toomAdd(a, {b.magnitude, !b.negative});
+    }
+
+
+    /**
+     * Evaluate the polynomial p0 + p1*x + p2*x^2 at 0, 1, -1, -2 and infinity.
+     */
+    std::array<ToomValue, 5> toomEvaluate(
+            const UnsignedBigInteger &p0,
+            const UnsignedBigInteger &p1,
+            const UnsignedBigInteger &p2
+    ) {
+        const UnsignedBigInteger p02 = p0 + p2;
+        const ToomValue atMinusOne = toomSubtract({p02, false}, {p1, false});
+        ToomValue atMinusTwo = toomAdd(atMinusOne, {p2, false});
+        atMinusTwo.magnitude <<= 1;
+        atMinusTwo = toomSubtract(atMinusTwo, {p0, false});
+
+        return {ToomValue{p0, false}, ToomValue{p02 + p1, false}, atMinusOne, atMinusTwo, ToomValue{p2, false}};
+    }
+
+
+    /**
+     * Interpolate the product polynomial from its values at 0, 1, -1, -2 and infinity (Bodrato's sequence), and
+     * evaluate it at x = 2^shift.
+     */
+    UnsignedBigInteger toomInterpolate(const std::array<ToomValue, 5> &values, size_t shift) {
+        const ToomValue &r0 = values[0], &r4 = values[4];
+
+        ToomValue r3 = toomSubtract(values[3], values[1]);
+        r3.magnitude /= 3; // Exact divisions
+        ToomValue r1 = toomSubtract(values[1], values[2]);
+        r1.magnitude >>= 1;
+        ToomValue r2 = toomSubtract(values[2], r0);
+        r3 = toomSubtract(r2, r3);
+        r3.magnitude >>= 1;
+        r3 = toomAdd(r3, {r4.magnitude << 1, false});
+        r2 = toomSubtract(toomAdd(r2, r1), r4);
+        r1 = toomSubtract(r1, r3);
+
+        // The coefficients of the product are non-negative, recompose them with Horner's method
+        const UnsignedBigInteger *coefficients[] = {&r3.magnitude, &r2.magnitude, &r1.magnitude, &r0.magnitude};
+        UnsignedBigInteger result(r4.magnitude);
+
+        for (const UnsignedBigInteger *coefficient : coefficients) {
+            result <<= shift;
+            result += *coefficient;
+        }
+
+        return result;
+    }
+
+
+    constexpr Digit powerOfTen(size_t exponent) {
+        return exponent == 0 ? 1 : 10 * powerOfTen(exponent - 1);
+    }
+
+
+    const size_t CHUNK_DIGITS = UnsignedBigInteger::DECIMAL_CHUNK_DIGITS;
+    const Digit DECIMAL_CHUNK = powerOfTen(CHUNK_DIGITS);
+
+
+    /**
+     * The powers 10^(DECIMAL_CHUNK_DIGITS * 2^level) which split the decimal conversions, computed on demand by
+     * repeated squaring. A deque keeps the references valid while the powers are added.
+     */
+    class DecimalPowers {
+    public:
+        const UnsignedBigInteger &operator[](size_t level) {
+            while (powers.size() <= level) {
+                powers.push_back(powers.back().square());
+            }
+
+            return powers[level];
+        }
+
+    private:
+        std::deque<UnsignedBigInteger> powers{UnsignedBigInteger(DECIMAL_CHUNK)};
+    };
+
+
+    /**
+     * Parse decimal characters chunk per chunk, with a single-digit multiply-add of the whole result per chunk.
+     */
+    UnsignedBigInteger parseChunked(std::string_view decimal) {
+        Digits result(1, 0);
+        size_t length = decimal.size() % CHUNK_DIGITS == 0 ? CHUNK_DIGITS : decimal.size() % CHUNK_DIGITS;
+
+        for (size_t begin = 0; begin < decimal.size(); begin += length, length = CHUNK_DIGITS) {
+            Digit chunk = 0, scale = 1;
+            for (size_t i = begin; i < begin + length; ++i) {
+                chunk = chunk * 10 + (decimal[i] - '0');
+                scale *= 10;
+            }
+
+            // result = result * scale + chunk
+            DoubleDigit carry = chunk;
+            for (Digit &digit : result) {
+                carry += static_cast<DoubleDigit>(digit) * scale;
+                digit = static_cast<Digit>(carry);
+                carry >>= UnsignedBigInteger::BITS;
+            }
+            if (carry != 0) {
+                result.push_back(static_cast<Digit>(carry));
+            }
+        }
+
+        return UnsignedBigInteger(result);
+    }
+
+
+    /**
+     * Parse decimal characters, as high * 10^lowSize + low above the threshold, lowSize being the largest
+     * DECIMAL_CHUNK_DIGITS * 2^level lower than the size.
+     */
+    UnsignedBigInteger parseDecimal(std::string_view decimal, DecimalPowers &powers) {
+        if (decimal.size() <= UnsignedBigInteger::DECIMAL_PARSE_SPLIT_THRESHOLD) {
+            return parseChunked(decimal);
+        }
+
+        size_t level = 0, lowSize = CHUNK_DIGITS;
+        while (2 * lowSize < decimal.size()) {
+            lowSize *= 2;
+            ++level;
+        }
+
+        const size_t highSize = decimal.size() - lowSize;
+        UnsignedBigInteger result = parseDecimal(decimal.substr(0, highSize), powers) * powers[level];
+        result += parseDecimal(decimal.substr(highSize), powers);
+        return result;
+    }
+
+
+    /**
+     * Append the decimal characters of a value, left-padded with zeros to width, with one short division by
+     * DECIMAL_CHUNK of the whole quotient per chunk.
+     */
+    void printChunked(const UnsignedBigInteger &value, size_t width, std::string &output) {
+        Digits quotient(value.digits);
+        std::vector<Digit> chunks; // Least significant first
+
+        do {
+            DoubleDigit remainder = 0;
+            for (size_t j = quotient.size(); j-- != 0;) {
+                remainder = remainder << UnsignedBigInteger::BITS | quotient[j];
+                quotient[j] = static_cast<Digit>(remainder / DECIMAL_CHUNK);
+                remainder %= DECIMAL_CHUNK;
+            }
+            while (quotient.size() > 1 && quotient.back() == 0) {
+                quotient.pop_back();
+            }
+
+            chunks.push_back(static_cast<Digit>(remainder));
+        } while (quotient.size() > 1 || quotient[0] != 0);
+
+        // The most significant chunk has no leading zeros, the next ones are padded
+        char buffer[CHUNK_DIGITS];
+        size_t length = 0;
+        for (Digit chunk = chunks.back(); chunk != 0 || length == 0; chunk /= 10) {
+            buffer[CHUNK_DIGITS - ++length] = static_cast<char>('0' + chunk % 10);
+        }
+
+        const size_t size = length + (chunks.size() - 1) * CHUNK_DIGITS;
+        if (width > size) {
+            output.append(width - size, '0');
+        }
+        output.append(buffer + CHUNK_DIGITS - length, length);
+
+        for (size_t i = chunks.size() - 1; i-- != 0;) {
+            Digit chunk = chunks[i];
+            for (size_t k = CHUNK_DIGITS; k-- != 0; chunk /= 10) {
+                buffer[k] = static_cast<char>('0' + chunk % 10);
+            }
+            output.append(buffer, CHUNK_DIGITS);
+        }
+    }
+
+
+    /**
+     * Append the decimal characters of a value, left-padded with zeros to width. Above the threshold, the value is
+     * divided by the power 10^lowSize of about half its size, and both the quotient and the remainder (padded to
+     * lowSize) are printed recursively.
+     */
+    void printDecimal(const UnsignedBigInteger &value, size_t width, DecimalPowers &powers, std::string &output) {
+        // log10(2) > 0.3
+        if (value.getMostSignificantBitIndex() * 3 / 10 <= UnsignedBigInteger::DECIMAL_PRINT_SPLIT_THRESHOLD) {
+            printChunked(value, width, output);
+            return;
+        }
+
+        const size_t half = (value.getMostSignificantBitIndex() + 1) / 2;
+        size_t level = 0, lowSize = CHUNK_DIGITS;
+        while (powers[level + 1].getMostSignificantBitIndex() <= half) {
+            lowSize *= 2;
+            ++level;
+        }
+
+        UnsignedBigInteger high, low;
+        value.divide(powers[level], high, low);
+        printDecimal(high, width > lowSize ? width - lowSize : 0, powers, output);
+        printDecimal(low, lowSize, powers, output);
+    }
+
+
+    /**
+     * Schoolbook product of digit buffers, accumulated into result (aSize + bSize digits, zero-initialized).
+     */
+    void multiplyDigits(Digit *result, const Digit *a, size_t aSize, const Digit *b, size_t bSize) {
+        for (size_t bDigitIdx = 0; bDigitIdx < bSize; ++bDigitIdx) {
+            DoubleDigit carry = 0;
+
+            for (size_t aDigitIdx = 0; aDigitIdx < aSize; ++aDigitIdx) {
+                carry += static_cast<DoubleDigit>(a[aDigitIdx]) * b[bDigitIdx] // on double-width
+                         + result[aDigitIdx + bDigitIdx];
+
+                // The static cast will only take the lowest BITS bits
+                result[aDigitIdx + bDigitIdx] = static_cast<Digit>(carry);
+
+                carry >>= UnsignedBigInteger::BITS; // Reminder
+            }
+
+            result[bDigitIdx + aSize] = static_cast<Digit>(carry);
+        }
+    }
+
+
+    /**
+     * Schoolbook square of a digit buffer, accumulated into result (2 * n digits, zero-initialized): each cross
+     * product is computed once and doubled.
+     */
+    void squareDigits(Digit *result, const Digit *a, size_t n) {
+        // Cross products a[i]*a[j] with i < j, computed once
+        for (size_t i = 0; i < n; ++i) {
+            DoubleDigit carry = 0;
+
+            for (size_t j = i + 1; j < n; ++j) {
+                carry += static_cast<DoubleDigit>(a[i]) * a[j] + result[i + j];
+                result[i + j] = static_cast<Digit>(carry);
+                carry >>= UnsignedBigInteger::BITS;
+            }
+
+            result[i + n] = static_cast<Digit>(carry);
+        }
+
+        // Double the cross products
+        Digit shifted = 0;
+        for (size_t j = 0; j < 2 * n; ++j) {
+            const Digit digit = result[j];
+            result[j] = digit << 1 | shifted;
+            shifted = digit >> (UnsignedBigInteger::BITS - 1);
+        }
+
+        // Add the squares a[i]*a[i] on the diagonal
+        DoubleDigit carry = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const DoubleDigit diagonal = static_cast<DoubleDigit>(a[i]) * a[i];
+            carry += static_cast<DoubleDigit>(result[2 * i]) + static_cast<Digit>(diagonal);
+            result[2 * i] = static_cast<Digit>(carry);
+            carry >>= UnsignedBigInteger::BITS;
+            carry += static_cast<DoubleDigit>(result[2 * i + 1])
+                     + static_cast<Digit>(diagonal >> UnsignedBigInteger::BITS);
+            result[2 * i + 1] = static_cast<Digit>(carry);
+            carry >>= UnsignedBigInteger::BITS;
+        }
+    }
+}
+
+
 /*
  * Constructors
  * ======================================================================
@@ -19,15 +311,13 @@ UnsignedBigInteger::UnsignedBigInteger(Digits pDigits) {
 
 
 UnsignedBigInteger::UnsignedBigInteger(const std::string &str) {
-    digits = Digits(1, 0);
-
-    std::istringstream inputStringStream(str);
-
-    inputStringStream >> *this; // see std::istream &operator>>
-
-    if (inputStringStream.fail() || !inputStringStream.eof()) {
+    // Leading blanks are skipped, like with operator>>
+    const size_t begin = str.find_first_not_of(" \t\n\v\f\r");
+    if (begin == std::string::npos || str.find_first_not_of("0123456789", begin) != std::string::npos) {
         throw std::runtime_error("Error: UnsignedBigInteger::string");
     }
+
+    *this = fromDecimal(std::string_view(str).substr(begin));
 }
 
 
@@ -36,7 +326,7 @@ UnsignedBigInteger::UnsignedBigInteger(const std::string &str) {
  * ======================================================================
  */
 UnsignedBigInteger &UnsignedBigInteger::operator=(Digit pDigit) {
-    *this = UnsignedBigInteger(pDigit);
+    digits.assign(1, pDigit); // Keeps the capacity
 
     return *this;
 }
@@ -162,12 +452,12 @@ UnsignedBigInteger &UnsignedBigInteger::operator+=(const UnsignedBigInteger &oth
     }
 
     size_t j = 0;
-    Digit64 carry = 0; // Since the digits size are 32 bits, we are working with 64 bits reminders
+    DoubleDigit carry = 0; // Carries are accumulated on double-width digits
 
     for (; j < otherSize; ++j) {
         carry = carry + digits[j] + other.digits[j];
-        digits[j] = static_cast<Digit>(carry); // The static cast will only take the lowest 32-bits
-        carry >>= BITS; // Take the highest 32-bits to add at the next iteration
+        digits[j] = static_cast<Digit>(carry); // The static cast will only take the lowest BITS bits
+        carry >>= BITS; // Take the highest BITS bits to add at the next iteration
     }
 
     /*
@@ -205,7 +495,7 @@ UnsignedBigInteger &UnsignedBigInteger::operator-=(const UnsignedBigInteger &del
     }
 
     size_t deltaSize = 0;
-    Digit64 carry = 0;
+    DoubleDigit carry = 0;
 
     /*
      * We are now guaranteed that the current big integer has a least the same number of digits of the delta.
@@ -213,7 +503,7 @@ UnsignedBigInteger &UnsignedBigInteger::operator-=(const UnsignedBigInteger &del
     for (; deltaSize < delta.digits.size(); ++deltaSize) {
         carry = carry + digits[deltaSize] - delta.digits[deltaSize];
         digits[deltaSize] = static_cast<Digit>(carry);
-        carry = ((carry >> BITS) ? -1 : 0); // -1 means "maximum 32 bits unsigned integer"
+        carry = ((carry >> BITS) ? -1 : 0); // -1 means "maximum double-width unsigned integer"
     }
 
     /*
@@ -232,40 +522,248 @@ UnsignedBigInteger &UnsignedBigInteger::operator-=(const UnsignedBigInteger &del
 
 
 UnsignedBigInteger UnsignedBigInteger::operator*(const UnsignedBigInteger &other) const {
-    const size_t aSize = digits.size();
-    const size_t bSize = other.digits.size();
+    if (this == &other) {
+        return square();
+    }
+
+    const size_t smallest = std::min(digits.size(), other.digits.size());
+
+    if (smallest < KARATSUBA_THRESHOLD) {
+        return schoolbookMultiply(*this, other);
+    } else if (smallest < TOOM3_THRESHOLD) {
+        return karatsubaMultiply(*this, other);
+    } else {
+        return toom3Multiply(*this, other);
+    }
+}
+
+
+UnsignedBigInteger &UnsignedBigInteger::operator*=(const UnsignedBigInteger &other) {
+    *this = (*this) * other;
+
+    return *this;
+}
+
+
+UnsignedBigInteger UnsignedBigInteger::schoolbookMultiply(const UnsignedBigInteger &a, const UnsignedBigInteger &b) {
+    const size_t aSize = a.digits.size();
+    const size_t bSize = b.digits.size();
 
     UnsignedBigInteger result; // result is initialized to zero
 
     // The maximum number of digits is aSize + bSize (like 999*999=998001 -> 6 digits)
     result.digits.resize(aSize + bSize, 0);
 
-    for (size_t bDigitIdx = 0; bDigitIdx < bSize; ++bDigitIdx) {
-        Digit64 carry = 0;
+    multiplyDigits(result.digits.data(), a.digits.data(), aSize, b.digits.data(), bSize);
+
+    result.trim(); // result was provisioned using the maximum digits
 
-        for (size_t aDigitIdx = 0; aDigitIdx < aSize; ++aDigitIdx) {
-            carry += static_cast<Digit64>(digits[aDigitIdx]) * other.digits[bDigitIdx] // on a 64-bits
-                     + result.digits[aDigitIdx + bDigitIdx];
+    return result;
+}
 
-            // The static cast will only take the lowest 32-bits
-            result.digits[aDigitIdx + bDigitIdx] = static_cast<Digit>(carry);
 
-            carry >>= UnsignedBigInteger::BITS; // Reminder
-        }
+UnsignedBigInteger UnsignedBigInteger::karatsubaMultiply(const UnsignedBigInteger &a, const UnsignedBigInteger &b) {
+    const size_t half = (std::max(a.digits.size(), b.digits.size()) + 1) / 2;
+    const UnsignedBigInteger a0 = a.slice(0, half), a1 = a.slice(half, half);
 
-        result.digits[bDigitIdx + aSize] = static_cast<Digit>(carry);
+    if (b.digits.size() <= half) {
+        // Unbalanced operands, only split the largest one
+        return a0 * b + ((a1 * b) <<= half * BITS);
+    } else if (a.digits.size() <= half) {
+        return karatsubaMultiply(b, a);
     }
 
-    result.trim(); // result was provisioned using the maximum digits
+    const UnsignedBigInteger b0 = b.slice(0, half), b1 = b.slice(half, half);
+    const UnsignedBigInteger z0 = a0 * b0;
+    const UnsignedBigInteger z2 = a1 * b1;
+    UnsignedBigInteger z1 = (a0 + a1) * (b0 + b1);
+    z1 -= z0;
+    z1 -= z2;
+
+    UnsignedBigInteger result(z2);
+    result <<= half * BITS;
+    result += z1;
+    result <<= half * BITS;
+    result += z0;
 
     return result;
 }
 
 
-UnsignedBigInteger &UnsignedBigInteger::operator*=(const UnsignedBigInteger &other) {
-    *this = (*this) * other;
+UnsignedBigInteger UnsignedBigInteger::toom3Multiply(const UnsignedBigInteger &a, const UnsignedBigInteger &b) {
+    const size_t third = (std::max(a.digits.size(), b.digits.size()) + 2) / 3;
 
-    return *this;
+    if (b.digits.size() <= third) {
+        // Unbalanced operands, only split the largest one
+        UnsignedBigInteger result = a.slice(2 * third, third) * b;
+        result <<= third * BITS;
+        result += a.slice(third, third) * b;
+        result <<= third * BITS;
+        result += a.slice(0, third) * b;
+
+        return result;
+    } else if (a.digits.size() <= third) {
+        return toom3Multiply(b, a);
+    }
+
+    const std::array<ToomValue, 5> aValues = toomEvaluate(a.slice(0, third), a.slice(third, third),
+                                                          a.slice(2 * third, third));
+    const std::array<ToomValue, 5> bValues = toomEvaluate(b.slice(0, third), b.slice(third, third),
+                                                          b.slice(2 * third, third));
+    std::array<ToomValue, 5> products;
+
+    for (size_t i = 0; i < products.size(); ++i) {
+        products[i] = {aValues[i].magnitude * bValues[i].magnitude, aValues[i].negative != bValues[i].negative};
+    }
+
+    return toomInterpolate(products, third * BITS);
+}
+
+
+UnsignedBigInteger UnsignedBigInteger::schoolbookSquare(const UnsignedBigInteger &a) {
+    const size_t n = a.digits.size();
+    UnsignedBigInteger result;
+    result.digits.resize(2 * n, 0);
+
+    squareDigits(result.digits.data(), a.digits.data(), n);
+    result.trim();
+
+    return result;
+}
+
+
+UnsignedBigInteger UnsignedBigInteger::karatsubaSquare(const UnsignedBigInteger &a) {
+    const size_t half = (a.digits.size() + 1) / 2;
+    const UnsignedBigInteger a0 = a.slice(0, half), a1 = a.slice(half, half);
+    const UnsignedBigInteger z0 = a0.square();
+    const UnsignedBigInteger z2 = a1.square();
+    UnsignedBigInteger z1 = (a0 + a1).square();
+    z1 -= z0;
+    z1 -= z2;
+
+    UnsignedBigInteger result(z2);
+    result <<= half * BITS;
+    result += z1;
+    result <<= half * BITS;
+    result += z0;
+
+    return result;
+}
+
+
+UnsignedBigInteger UnsignedBigInteger::toom3Square(const UnsignedBigInteger &a) {
+    const size_t third = (a.digits.size() + 2) / 3;
+    const std::array<ToomValue, 5> values = toomEvaluate(a.slice(0, third), a.slice(third, third),
+                                                         a.slice(2 * third, third));
+    std::array<ToomValue, 5> squares;
+
+    for (size_t i = 0; i < squares.size(); ++i) {
+        squares[i] = {values[i].magnitude.square(), false};
+    }
+
+    return toomInterpolate(squares, third * BITS);
+}
+
+
+UnsignedBigInteger UnsignedBigInteger::square() const {
+    const size_t n = digits.size();
+
+    if (n < KARATSUBA_SQUARE_THRESHOLD) {
+        return schoolbookSquare(*this);
+    } else if (n < TOOM3_SQUARE_THRESHOLD) {
+        return karatsubaSquare(*this);
+    } else {
+        return toom3Square(*this);
+    }
+}
+
+
+void UnsignedBigInteger::add(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b) {
+    const UnsignedBigInteger &longer = a.digits.size() >= b.digits.size() ? a : b;
+    const UnsignedBigInteger &shorter = &longer == &a ? b : a;
+    const size_t longSize = longer.digits.size(), shortSize = shorter.digits.size();
+
+    // Resizing out keeps its digits, and every digit is read before being written: out may alias a or b
+    out.digits.resize(longSize + 1);
+
+    size_t j = 0;
+    DoubleDigit carry = 0;
+
+    for (; j < shortSize; ++j) {
+        carry += static_cast<DoubleDigit>(longer.digits[j]) + shorter.digits[j];
+        out.digits[j] = static_cast<Digit>(carry);
+        carry >>= BITS;
+    }
+
+    for (; j < longSize; ++j) {
+        carry += longer.digits[j];
+        out.digits[j] = static_cast<Digit>(carry);
+        carry >>= BITS;
+    }
+
+    out.digits[longSize] = static_cast<Digit>(carry);
+    out.trim();
+}
+
+
+void UnsignedBigInteger::subtract(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b) {
+    if (a < b) {
+        throw std::underflow_error("Error: UnsignedBigInteger: subtraction underflow");
+    }
+
+    const size_t aSize = a.digits.size(), bSize = b.digits.size();
+    out.digits.resize(aSize);
+
+    size_t j = 0;
+    DoubleDigit carry = 0;
+
+    for (; j < bSize; ++j) {
+        carry = carry + a.digits[j] - b.digits[j];
+        out.digits[j] = static_cast<Digit>(carry);
+        carry = ((carry >> BITS) ? -1 : 0);
+    }
+
+    for (; j < aSize; ++j) {
+        carry += a.digits[j];
+        out.digits[j] = static_cast<Digit>(carry);
+        carry = ((carry >> BITS) ? -1 : 0);
+    }
+
+    out.trim();
+}
+
+
+void UnsignedBigInteger::multiply(UnsignedBigInteger &out, const UnsignedBigInteger &a, const UnsignedBigInteger &b,
+                                  Digits &scratch) {
+    if (&a == &b) {
+        square(out, a, scratch);
+        return;
+    }
+
+    const size_t aSize = a.digits.size(), bSize = b.digits.size();
+    if (std::min(aSize, bSize) >= KARATSUBA_THRESHOLD) {
+        out = a * b;
+        return;
+    }
+
+    scratch.assign(aSize + bSize, 0);
+    multiplyDigits(scratch.data(), a.digits.data(), aSize, b.digits.data(), bSize);
+    out.digits.swap(scratch);
+    out.trim();
+}
+
+
+void UnsignedBigInteger::square(UnsignedBigInteger &out, const UnsignedBigInteger &a, Digits &scratch) {
+    const size_t n = a.digits.size();
+    if (n >= KARATSUBA_SQUARE_THRESHOLD) {
+        out = a.square();
+        return;
+    }
+
+    scratch.assign(2 * n, 0);
+    squareDigits(scratch.data(), a.digits.data(), n);
+    out.digits.swap(scratch);
+    out.trim();
 }
 
 
@@ -313,14 +811,14 @@ UnsignedBigInteger &UnsignedBigInteger::operator<<=(size_t shiftSize) {
     // Left-shifting zero has no effect
     if (digits.back() != 0 && shiftSize != 0) {
         const size_t n = shiftSize / BITS;
-        digits.insert(digits.begin(), n, 0); // Insert zeros for every 32-bits shifts
+        digits.insert(digits.begin(), n, 0); // Insert zeros for every BITS-bits shifts
 
         // Propagate the shift trough all digits
         shiftSize -= n * BITS;
-        Digit64 carry = 0;
+        DoubleDigit carry = 0;
 
         for (size_t j = n; j < digits.size(); ++j) {
-            carry |= static_cast<Digit64>(digits[j]) << shiftSize;
+            carry |= static_cast<DoubleDigit>(digits[j]) << shiftSize;
             digits[j] = static_cast<Digit>(carry);
             carry >>= BITS;
         }
@@ -350,7 +848,7 @@ UnsignedBigInteger &UnsignedBigInteger::operator>>=(size_t shiftSize) {
     } else {
         digits.erase(digits.begin(), digits.begin() + n);
         shiftSize -= n * BITS;
-        Digit64 k = 0;
+        DoubleDigit k = 0;
         for (size_t j = digits.size(); j-- != 0;) {
             k = k << BITS | digits[j];
             digits[j] = static_cast<Digit>(k >> shiftSize);
@@ -441,13 +939,12 @@ std::istream &ecc::operator>>(std::istream &inputStream, UnsignedBigInteger &res
     inputStream >> digit;
 
     if (inputStream.good() && std::isdigit(digit)) {
-        result = digit - '0'; // Convert from ASCII
-
+        std::string decimal(1, digit);
         while (std::isdigit(inputStream.peek())) {
-            inputStream >> digit;
-            // Safe to use result as a number since we implemented these operators
-            result = UnsignedBigInteger(10) * result + (digit - '0');
+            decimal.push_back(static_cast<char>(inputStream.get()));
         }
+
+        result = UnsignedBigInteger::fromDecimal(decimal);
     } else {
         inputStream.setstate(std::ios_base::failbit);
     }
@@ -499,15 +996,15 @@ void UnsignedBigInteger::divide(
 
     UnsignedBigInteger w;
     w.digits.resize(n + 1);
-    const Digit64 MAX_DIGIT = (static_cast<Digit64>(1) << BITS) - 1;
+    const DoubleDigit MAX_DIGIT = (static_cast<DoubleDigit>(1) << BITS) - 1;
     for (size_t j = m - n; j-- != 0;) {
         // Estimate quotient digit.
-        Digit64 qhat = std::min(MAX_DIGIT,
-                                (static_cast<Digit64>(reminder.digits[j + n]) << BITS |
+        DoubleDigit qhat = std::min(MAX_DIGIT,
+                                (static_cast<DoubleDigit>(reminder.digits[j + n]) << BITS |
                                  reminder.digits[j + n - 1]) / vn);
 
         // Compute partial product (w = qhat * divider).
-        Digit64 k = 0;
+        DoubleDigit k = 0;
         for (size_t i = 0; i < n; ++i) {
             k += qhat * divider.digits[i];
             w.digits[i] = static_cast<Digit>(k);
@@ -551,23 +1048,156 @@ void UnsignedBigInteger::divide(
 
 
 size_t UnsignedBigInteger::getMostSignificantBitIndex() const {
+    if (digits.back() == 0) {
+        return 0; // Zero has no significant bit
+    }
+
     size_t d = BITS - 1;
     for (; digits.back() >> d == 0; d--); // Scan the last block (highest order)
 
     return (digits.size() - 1) * BITS + 1 + d;
 }
 
-std::string UnsignedBigInteger::to_string() const {
-    std::ostringstream outputStringStream;
-    UnsignedBigInteger quotient(*this), reminder;
+uint8_t UnsignedBigInteger::getBit(size_t bitIndex) const {
+    const size_t digitIndex = bitIndex / BITS;
+
+    if (digitIndex >= digits.size()) {
+        return 0;
+    }
 
-    do {
-        quotient.divide(10, quotient, reminder);
-        outputStringStream << reminder.digits[0];
-    } while (quotient.digits.back() != 0);
+    return (digits[digitIndex] >> (bitIndex % BITS)) & 1;
+}
+
+std::vector<int8_t> UnsignedBigInteger::getNonAdjacentForm(unsigned width) const {
+    if (width < 2 || width > 8) {
+        throw std::invalid_argument("Error: UnsignedBigInteger: wNAF width must be between 2 and 8");
+    }
+
+    const size_t bitCount = getMostSignificantBitIndex();
+    std::vector<int8_t> naf(bitCount + 1, 0);
+    Digit carry = 0;
+
+    for (size_t bitIndex = 0; bitIndex <= bitCount;) {
+        if (getBit(bitIndex) == carry) {
+            ++bitIndex;
+            continue;
+        }
+
+        // Read the next window, which may span two digits
+        const size_t digitIndex = bitIndex / BITS, shift = bitIndex % BITS;
+        Digit window = digitIndex < digits.size() ? digits[digitIndex] >> shift : 0;
+        if (shift + width > BITS && digitIndex + 1 < digits.size()) {
+            window |= digits[digitIndex + 1] << (BITS - shift);
+        }
 
-    std::string output(outputStringStream.str());
-    std::reverse(output.begin(), output.end());
+        // The window is odd, make it a signed digit in ]-2^(w-1), 2^(w-1)[
+        int word = static_cast<int>(window & ((Digit(1) << width) - 1)) + static_cast<int>(carry);
+        carry = word >> (width - 1);
+        word -= static_cast<int>(carry << width);
+
+        naf[bitIndex] = static_cast<int8_t>(word);
+        bitIndex += width;
+    }
+
+    while (!naf.empty() && naf.back() == 0) {
+        naf.pop_back();
+    }
+
+    return naf;
+}
+
+UnsignedBigInteger UnsignedBigInteger::fromBytes(std::span<const uint8_t> bytes) {
+    const size_t bytesPerDigit = BITS / 8;
+    Digits result(bytes.size() / bytesPerDigit + 1, 0);
+
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        const size_t position = bytes.size() - 1 - i; // Byte position from the least significant one
+        result[position / bytesPerDigit] |= static_cast<Digit>(bytes[i]) << (8 * (position % bytesPerDigit));
+    }
+
+    return UnsignedBigInteger(result);
+}
+
+void UnsignedBigInteger::toBytes(std::span<uint8_t> output) const {
+    const size_t bytesPerDigit = BITS / 8;
+
+    if ((getMostSignificantBitIndex() + 7) / 8 > output.size()) {
+        throw std::overflow_error("Error: UnsignedBigInteger: value does not fit in the output bytes");
+    }
+
+    for (size_t i = 0; i < output.size(); ++i) {
+        const size_t position = output.size() - 1 - i;
+        const size_t digitIndex = position / bytesPerDigit;
+        output[i] = digitIndex < digits.size()
+                    ? static_cast<uint8_t>(digits[digitIndex] >> (8 * (position % bytesPerDigit))) : 0;
+    }
+}
+
+UnsignedBigInteger UnsignedBigInteger::fromHex(std::string_view hex) {
+    const size_t nibblesPerDigit = BITS / 4;
+
+    if (hex.empty()) {
+        throw std::invalid_argument("Error: UnsignedBigInteger: invalid hexadecimal string");
+    }
+
+    Digits result(hex.size() / nibblesPerDigit + 1, 0);
+    for (size_t i = 0; i < hex.size(); ++i) {
+        const char c = hex[i];
+        Digit nibble;
+        if (c >= '0' && c <= '9') {
+            nibble = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            nibble = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            nibble = c - 'A' + 10;
+        } else {
+            throw std::invalid_argument("Error: UnsignedBigInteger: invalid hexadecimal string");
+        }
+
+        const size_t position = hex.size() - 1 - i; // Nibble position from the least significant one
+        result[position / nibblesPerDigit] |= nibble << (4 * (position % nibblesPerDigit));
+    }
+
+    return UnsignedBigInteger(result);
+}
+
+void UnsignedBigInteger::toHex(std::span<char> output) const {
+    const char *const alphabet = "0123456789abcdef";
+    const size_t nibblesPerDigit = BITS / 4;
+
+    if ((getMostSignificantBitIndex() + 3) / 4 > output.size()) {
+        throw std::overflow_error("Error: UnsignedBigInteger: value does not fit in the output characters");
+    }
+
+    for (size_t i = 0; i < output.size(); ++i) {
+        const size_t position = output.size() - 1 - i;
+        const size_t digitIndex = position / nibblesPerDigit;
+        output[i] = alphabet[digitIndex < digits.size()
+                             ? (digits[digitIndex] >> (4 * (position % nibblesPerDigit))) & 0xf : 0];
+    }
+}
+
+std::string UnsignedBigInteger::toHex() const {
+    const size_t nibbles = (getMostSignificantBitIndex() + 3) / 4;
+    std::string output(nibbles == 0 ? 1 : nibbles, '0');
+    toHex(output);
+
+    return output;
+}
+
+UnsignedBigInteger UnsignedBigInteger::fromDecimal(std::string_view decimal) {
+    if (decimal.empty() || decimal.find_first_not_of("0123456789") != std::string_view::npos) {
+        throw std::invalid_argument("Error: UnsignedBigInteger: invalid decimal string");
+    }
+
+    DecimalPowers powers;
+    return parseDecimal(decimal, powers);
+}
+
+std::string UnsignedBigInteger::to_string() const {
+    std::string output;
+    DecimalPowers powers;
+    printDecimal(*this, 0, powers, output);
 
     return output;
 }
@@ -578,3 +1208,14 @@ void UnsignedBigInteger::trim() {
         digits.pop_back();
     }
 }
+
+
+UnsignedBigInteger UnsignedBigInteger::slice(size_t from, size_t count) const {
+    if (from >= digits.size()) {
+        return UnsignedBigInteger(0);
+    }
+
+    const size_t to = std::min(digits.size(), from + count);
+
+    return UnsignedBigInteger(Digits(digits.begin() + from, digits.begin() + to));
+}
@@ -0,0 +1,113 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "../../includes/ecc/DigitResource.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/ECDSA.h"
+
+using ecc::DigitResource;
+using ecc::DigitResourceScope;
+using ecc::UnsignedBigInteger;
+using ecc::Montgomery;
+using ecc::ECDSA;
+
+
+/**
+ * Heap resource counting its live blocks.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    long live = 0;
+    long total = 0;
+
+private:
+    void *do_allocate(size_t bytes, size_t alignment) override {
+        ++live;
+        ++total;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *pointer, size_t bytes, size_t alignment) override {
+        --live;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+
+TEST(DigitResource, scopes) {
+    CountingResource outer, inner;
+    EXPECT_EQ(std::pmr::new_delete_resource(), DigitResource::current());
+
+    UnsignedBigInteger heapValue = UnsignedBigInteger(1) << 100;
+    {
+        DigitResourceScope outerScope(&outer);
+        EXPECT_EQ(&outer, DigitResource::current());
+        UnsignedBigInteger a = UnsignedBigInteger(1) << 200;
+        EXPECT_LT(0, outer.live);
+
+        {
+            DigitResourceScope innerScope(&inner);
+            const UnsignedBigInteger b = a * a;
+            EXPECT_EQ(UnsignedBigInteger(1) << 400, b);
+            EXPECT_LT(0, inner.live);
+
+            // Blocks return to the resource they come from, not to the current one
+            const long outerLive = outer.live, innerLive = inner.live;
+            {
+                const UnsignedBigInteger dropped = std::move(a);
+            }
+            EXPECT_EQ(outerLive - 1, outer.live);
+            EXPECT_EQ(innerLive, inner.live);
+
+            heapValue.digits = Digits();
+            EXPECT_EQ(innerLive, inner.live);
+        }
+
+        EXPECT_EQ(0, inner.live);
+        EXPECT_EQ(&outer, DigitResource::current());
+    }
+
+    EXPECT_EQ(0, outer.live);
+    EXPECT_EQ(std::pmr::new_delete_resource(), DigitResource::current());
+}
+
+
+TEST(DigitResource, arenaPerRequest) {
+    const std::vector<uint8_t> digest(32, 0x5a), privateKey(32, 0x17), nonce(32, 0x42);
+    const ECDSA::PublicKey publicKey = ECDSA::publicKey(privateKey);
+    const ECDSA::Signature expected = ECDSA::sign(digest, privateKey, nonce);
+
+    CountingResource upstream;
+    std::pmr::monotonic_buffer_resource arena(&upstream);
+
+    for (int request = 0; request < 3; ++request) {
+        ECDSA::Signature signature{};
+        {
+            DigitResourceScope scope(&arena);
+            signature = ECDSA::sign(digest, privateKey, nonce);
+            EXPECT_TRUE(ECDSA::verify(digest, signature, publicKey));
+        }
+
+        arena.release();
+        EXPECT_EQ(expected, signature);
+        EXPECT_EQ(0, upstream.live);
+    }
+    EXPECT_LT(0, upstream.total);
+
+    // The interned contexts are built on the heap, and stay valid after the release of the arena
+    const UnsignedBigInteger modulus(1000003);
+    const Montgomery *context;
+    {
+        DigitResourceScope scope(&arena);
+        context = Montgomery::forModulus(modulus);
+    }
+    arena.release();
+
+    EXPECT_EQ(context, Montgomery::forModulus(modulus));
+    EXPECT_EQ(modulus, context->modulus);
+    EXPECT_EQ(UnsignedBigInteger(6), context->multiplication(UnsignedBigInteger(2), UnsignedBigInteger(3)));
+}
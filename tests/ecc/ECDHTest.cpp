@@ -0,0 +1,107 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "../../includes/ecc/ECDH.h"
+#include "../../includes/ecc/ECDSA.h"
+
+using ecc::ECDH;
+using ecc::ECDSA;
+using ecc::P256;
+using ecc::Point;
+using ecc::UnsignedBigInteger;
+
+static std::vector<uint8_t> hexToBytes(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        bytes.push_back(static_cast<uint8_t>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+
+    return bytes;
+}
+
+
+static std::vector<uint8_t> scalarToBytes(const UnsignedBigInteger &k) {
+    std::vector<uint8_t> bytes(32);
+    k.toBytes(bytes);
+    return bytes;
+}
+
+
+static std::vector<uint8_t> abscissa(const Point &point) {
+    return scalarToBytes(point.normalize().x.toUnsigned());
+}
+
+
+TEST(ECDH, knownAnswer) {
+    // NIST CAVS, ECC CDH primitive, P-256 count 0
+    const std::vector<uint8_t> peer = hexToBytes(
+            "04700c48f77f56584c5cc632ca65640db91b6bacce3a4df6b42ce7cc838833d287"
+            "db71e509e3fd9b060ddb20ba5c51dcc5948d46fbf640dfe0441782cab85fa4ac");
+    const std::vector<uint8_t> privateKey = hexToBytes(
+            "7d7dc5f71eb29ddaf80d6214632eeae03d9058af1fb6d22ed80badb62bc1a534");
+
+    ECDH::SharedSecret secret = ECDH::sharedSecret(privateKey, peer);
+    EXPECT_EQ(hexToBytes("46fc62106420ff012e54a434fbdd2d25ccc5852060561e68040dd7778997bd7b"),
+              std::vector<uint8_t>(secret.begin(), secret.end()));
+}
+
+
+TEST(ECDH, agreement) {
+    const std::vector<uint8_t> alice = hexToBytes("c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721");
+    const std::vector<uint8_t> bob = hexToBytes("7d7dc5f71eb29ddaf80d6214632eeae03d9058af1fb6d22ed80badb62bc1a534");
+    const ECDSA::PublicKey alicePublic = ECDSA::publicKey(alice), bobPublic = ECDSA::publicKey(bob);
+
+    ECDH::SharedSecret aliceSecret = ECDH::sharedSecret(alice, bobPublic);
+    EXPECT_EQ(aliceSecret, ECDH::sharedSecret(bob, alicePublic));
+
+    const Point expected = ECDSA::decodePublicKey(bobPublic) * UnsignedBigInteger::fromBytes(alice);
+    EXPECT_EQ(abscissa(expected), std::vector<uint8_t>(aliceSecret.begin(), aliceSecret.end()));
+}
+
+
+TEST(ECDH, edgeScalars) {
+    const ECDSA::PublicKey peer = ECDSA::publicKey(
+            hexToBytes("c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721"));
+    const Point q = ECDSA::decodePublicKey(peer);
+
+    // Small scalars and the scalars whose ladder goes through the infinity point
+    for (const UnsignedBigInteger &k : {UnsignedBigInteger(1), UnsignedBigInteger(2), UnsignedBigInteger(3),
+                                        P256::n - UnsignedBigInteger(3), P256::n - UnsignedBigInteger(2),
+                                        P256::n - UnsignedBigInteger(1)}) {
+        ECDH::SharedSecret secret = ECDH::sharedSecret(scalarToBytes(k), peer);
+        EXPECT_EQ(abscissa(q * k), std::vector<uint8_t>(secret.begin(), secret.end())) << k;
+    }
+}
+
+
+TEST(ECDH, invalidInputs) {
+    const std::vector<uint8_t> privateKey = hexToBytes(
+            "c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721");
+    ECDSA::PublicKey peer = ECDSA::publicKey(privateKey);
+
+    EXPECT_THROW(ECDH::sharedSecret(std::vector<uint8_t>(32, 0), peer), std::invalid_argument);
+    EXPECT_THROW(ECDH::sharedSecret(scalarToBytes(P256::n), peer), std::invalid_argument);
+    EXPECT_THROW(ECDH::sharedSecret(std::vector<uint8_t>(31, 1), peer), std::invalid_argument);
+
+    peer[64] ^= 1; // Not on the curve anymore
+    EXPECT_THROW(ECDH::sharedSecret(privateKey, peer), std::invalid_argument);
+}
+
+
+TEST(ECDH, sharedSecrets) {
+    const std::vector<uint8_t> privateKey = hexToBytes(
+            "c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721");
+    std::vector<ECDSA::PublicKey> peers;
+    for (uint8_t i = 1; i <= 5; ++i) {
+        peers.push_back(ECDSA::publicKey(std::vector<uint8_t>(32, i)));
+    }
+
+    std::vector<std::span<const uint8_t>> spans(peers.begin(), peers.end());
+    std::vector<ECDH::SharedSecret> secrets = ECDH::sharedSecrets(privateKey, spans);
+    ASSERT_EQ(peers.size(), secrets.size());
+    for (size_t i = 0; i < peers.size(); ++i) {
+        EXPECT_EQ(ECDH::sharedSecret(privateKey, peers[i]), secrets[i]);
+    }
+
+    EXPECT_TRUE(ECDH::sharedSecrets(privateKey, {}).empty());
+}
@@ -0,0 +1,167 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "../../includes/ecc/ECDSA.h"
+
+using ecc::ECDSA;
+
+/*
+ * Known-answer tests from RFC 6979, A.2.5 (P-256 with SHA-256, messages "sample" and "test"), which give the nonce
+ * and thus exercise the signing path deterministically.
+ */
+
+static std::vector<uint8_t> hexToBytes(const std::string &hex) {
+    std::vector<uint8_t> bytes;
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        bytes.push_back(static_cast<uint8_t>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+    }
+
+    return bytes;
+}
+
+
+static const std::vector<uint8_t> privateKey = hexToBytes(
+        "c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721");
+static const std::vector<uint8_t> publicKey = hexToBytes(
+        "0460fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6"
+        "7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299");
+
+
+TEST(ECDSA, publicKey) {
+    ECDSA::PublicKey computed = ECDSA::publicKey(privateKey);
+    EXPECT_EQ(publicKey, std::vector<uint8_t>(computed.begin(), computed.end()));
+
+    EXPECT_THROW(ECDSA::publicKey(std::vector<uint8_t>(32, 0)), std::invalid_argument);
+    EXPECT_THROW(ECDSA::publicKey(std::vector<uint8_t>(32, 0xff)), std::invalid_argument);
+    EXPECT_THROW(ECDSA::publicKey(std::vector<uint8_t>(31, 1)), std::invalid_argument);
+}
+
+
+TEST(ECDSA, knownAnswers) {
+    struct Vector {
+        std::string digest, nonce, signature;
+    };
+    const Vector vectors[] = {
+            {"af2bdbe1aa9b6ec1e2ade1d694f41fc71a831d0268e9891562113d8a62add1bf",
+             "a6e3c57dd01abe90086538398355dd4c3b17aa873382b0f24d6129493d8aad60",
+             "efd48b2aacb6a8fd1140dd9cd45e81d69d2c877b56aaf991c34d0ea84eaf3716"
+             "f7cb1c942d657c41d436c7a1b6e29f65f3e900dbb9aff4064dc4ab2f843acda8"},
+            {"9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08",
+             "d16b6ae827f17175e040871a1c7ec3500192c4c92677336ec2537acaee0008e0",
+             "f1abb023518351cd71d881567b1ea663ed3efcf6c5132b354f28d3b0b7d38367"
+             "019f4113742a2b14bd25926b49c649155f267e60d3814b4c0cc84250e46f0083"}
+    };
+
+    for (const Vector &vector : vectors) {
+        std::vector<uint8_t> digest = hexToBytes(vector.digest), expected = hexToBytes(vector.signature);
+        ECDSA::Signature signature = ECDSA::sign(digest, privateKey, hexToBytes(vector.nonce));
+
+        EXPECT_EQ(expected, std::vector<uint8_t>(signature.begin(), signature.end()));
+        EXPECT_TRUE(ECDSA::verify(digest, expected, publicKey));
+    }
+}
+
+
+TEST(ECDSA, verifyRejections) {
+    std::vector<uint8_t> digest = hexToBytes("af2bdbe1aa9b6ec1e2ade1d694f41fc71a831d0268e9891562113d8a62add1bf");
+    ECDSA::Signature signature = ECDSA::sign(digest, privateKey);
+    EXPECT_TRUE(ECDSA::verify(digest, signature, publicKey));
+
+    // Tampered digest, signature and public key
+    std::vector<uint8_t> otherDigest(digest);
+    otherDigest[31] ^= 1;
+    EXPECT_FALSE(ECDSA::verify(otherDigest, signature, publicKey));
+
+    for (size_t index : {0, 31, 32, 63}) {
+        ECDSA::Signature tampered(signature);
+        tampered[index] ^= 0x10;
+        EXPECT_FALSE(ECDSA::verify(digest, tampered, publicKey));
+    }
+
+    std::vector<uint8_t> offCurve(publicKey);
+    offCurve[64] ^= 1;
+    EXPECT_FALSE(ECDSA::verify(digest, signature, offCurve));
+
+    // Out of range components and malformed encodings
+    std::vector<uint8_t> zeros(ECDSA::SIGNATURE_BYTES, 0), ones(ECDSA::SIGNATURE_BYTES, 0xff);
+    EXPECT_FALSE(ECDSA::verify(digest, zeros, publicKey));
+    EXPECT_FALSE(ECDSA::verify(digest, ones, publicKey));
+    EXPECT_FALSE(ECDSA::verify(digest, std::span(signature).first(63), publicKey));
+    EXPECT_FALSE(ECDSA::verify(digest, signature, std::span(publicKey).first(64)));
+}
+
+
+TEST(ECDSA, compressedPublicKey) {
+    std::vector<uint8_t> digest = hexToBytes("af2bdbe1aa9b6ec1e2ade1d694f41fc71a831d0268e9891562113d8a62add1bf");
+    ECDSA::Signature signature = ECDSA::sign(digest, privateKey);
+    const std::vector<uint8_t> compressed = ECDSA::decodePublicKey(publicKey).compress();
+
+    // y ends with 0x99, hence the odd prefix
+    EXPECT_EQ(size_t(ECDSA::COMPRESSED_PUBLIC_KEY_BYTES), compressed.size());
+    EXPECT_EQ(0x03, compressed[0]);
+    EXPECT_TRUE(std::equal(compressed.begin() + 1, compressed.end(), publicKey.begin() + 1));
+    EXPECT_EQ(ECDSA::decodePublicKey(publicKey), ECDSA::decodePublicKey(compressed));
+    EXPECT_TRUE(ECDSA::verify(digest, signature, compressed));
+
+    // The other root is the opposite key
+    std::vector<uint8_t> opposite(compressed);
+    opposite[0] = 0x02;
+    EXPECT_FALSE(ECDSA::verify(digest, signature, opposite));
+    opposite[0] = 0x04;
+    EXPECT_FALSE(ECDSA::verify(digest, signature, opposite));
+}
+
+
+TEST(ECDSA, verifyBatch) {
+    const size_t count = 8;
+    std::vector<std::vector<uint8_t>> digests, keys;
+    std::vector<ECDSA::Signature> signatures;
+    std::vector<ECDSA::PublicKey> publicKeys;
+    std::vector<ECDSA::BatchItem> items;
+
+    for (size_t i = 0; i < count; ++i) {
+        std::vector<uint8_t> key(privateKey);
+        key[31] ^= static_cast<uint8_t>(i);
+        digests.emplace_back(32, static_cast<uint8_t>(i));
+        publicKeys.push_back(ECDSA::publicKey(key));
+        keys.push_back(key);
+    }
+
+    std::vector<int> recoveryIds(count);
+    for (size_t i = 0; i < count; ++i) {
+        signatures.push_back(ECDSA::sign(digests[i], keys[i], &recoveryIds[i]));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_GE(recoveryIds[i], 0);
+        EXPECT_LE(recoveryIds[i], 3);
+        items.push_back({digests[i], signatures[i], publicKeys[i], recoveryIds[i]});
+    }
+
+    // Randomized check, with and without the recovery ids
+    EXPECT_EQ(std::vector<bool>(count, true), ECDSA::verifyBatch(items));
+    std::vector<ECDSA::BatchItem> withoutIds(items);
+    for (ECDSA::BatchItem &item : withoutIds) {
+        item.recoveryId = -1;
+    }
+    EXPECT_EQ(std::vector<bool>(count, true), ECDSA::verifyBatch(withoutIds));
+
+    // A wrong recovery id only disables the randomized check
+    items[2].recoveryId ^= 1;
+    EXPECT_EQ(std::vector<bool>(count, true), ECDSA::verifyBatch(items));
+    items[2].recoveryId ^= 1;
+
+    // The invalid signatures are located
+    ECDSA::Signature tampered(signatures[5]);
+    tampered[40] ^= 1;
+    std::vector<uint8_t> malformed(signatures[6].begin(), signatures[6].end() - 1);
+    items[1].digest = digests[0];
+    items[5].signature = tampered;
+    items[6].signature = malformed;
+
+    std::vector<bool> expected(count, true);
+    expected[1] = expected[5] = expected[6] = false;
+    EXPECT_EQ(expected, ECDSA::verifyBatch(items));
+
+    EXPECT_TRUE(ECDSA::verifyBatch({}).empty());
+}
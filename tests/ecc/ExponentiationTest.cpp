@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/ModularBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/P256Field.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Exponentiation.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::ModularBigInteger;
+using ecc::Montgomery;
+using ecc::P256Field;
+using ecc::Field;
+using ecc::FieldElement;
+using ecc::Exponentiation;
+using ecc::P256;
+
+
+/**
+ * Reference square-and-multiply on big integers.
+ */
+static UnsignedBigInteger naivePow(const UnsignedBigInteger &base, const UnsignedBigInteger &exponent,
+                                   const UnsignedBigInteger &modulus) {
+    UnsignedBigInteger result(1);
+
+    for (size_t i = exponent.getMostSignificantBitIndex(); i-- > 0;) {
+        result = (result * result) % modulus;
+        if (exponent.getBit(i)) {
+            result = (result * base) % modulus;
+        }
+    }
+
+    return result % modulus;
+}
+
+
+TEST(Exponentiation, smallModulus) {
+    const UnsignedBigInteger modulus(1009);
+    const Montgomery *context = Montgomery::forModulus(modulus);
+
+    for (const UnsignedBigInteger &base : {UnsignedBigInteger(0), UnsignedBigInteger(1), UnsignedBigInteger(2),
+                                           UnsignedBigInteger(1008), UnsignedBigInteger(5000)}) {
+        for (UnsignedBigInteger exponent(0); exponent < UnsignedBigInteger(300); exponent++) {
+            const UnsignedBigInteger expected = naivePow(base, exponent, modulus);
+            EXPECT_EQ(expected, context->pow(base, exponent));
+            EXPECT_EQ(expected, context->powConstantTime(base, exponent));
+            EXPECT_EQ(expected, ModularBigInteger(base, modulus).pow(exponent).value);
+        }
+    }
+
+    // Fermat's little theorem
+    EXPECT_EQ(UnsignedBigInteger(1), context->pow(UnsignedBigInteger(123), modulus - UnsignedBigInteger(1)));
+}
+
+
+TEST(Exponentiation, largeExponents) {
+    const UnsignedBigInteger exponents[] = {
+            UnsignedBigInteger("65537"),
+            UnsignedBigInteger("48439561293906451759052585252797914202762949526041747995844080717082404635286"),
+            P256::m - UnsignedBigInteger(2),
+            (UnsignedBigInteger(1) << 255) + UnsignedBigInteger(1)
+    };
+    const UnsignedBigInteger base("36134250956749795798585127919587881956611106672985015071877198253568414405109");
+    const Montgomery *context = Montgomery::forModulus(P256::m);
+
+    for (const UnsignedBigInteger &exponent : exponents) {
+        const UnsignedBigInteger expected = naivePow(base, exponent, P256::m);
+        EXPECT_EQ(expected, context->pow(base, exponent));
+        EXPECT_EQ(expected, context->powConstantTime(base, exponent));
+
+        const FieldElement element(base, P256Field::instance());
+        EXPECT_EQ(expected, Exponentiation::slidingWindow(element, exponent).toUnsigned());
+        EXPECT_EQ(expected, Exponentiation::fixedWindow(element, exponent, 256).toUnsigned());
+    }
+
+    // The fixed size bounds the exponent
+    EXPECT_THROW(context->powConstantTime(base, context->r), std::invalid_argument);
+    const FieldElement element(base, P256Field::instance());
+    EXPECT_THROW(Exponentiation::fixedWindow(element, UnsignedBigInteger(1) << 20, 20), std::invalid_argument);
+    EXPECT_THROW(Exponentiation::fixedWindow(element, UnsignedBigInteger(1), 1024), std::invalid_argument);
+    EXPECT_EQ(naivePow(base, UnsignedBigInteger(0xfffff), P256::m),
+              Exponentiation::fixedWindow(element, UnsignedBigInteger(0xfffff), 20).toUnsigned());
+}
+
+
+TEST(Exponentiation, wideModulus) {
+    // 2^521 - 1 is prime, and does not fit in the fixed-width field elements
+    const UnsignedBigInteger modulus = (UnsignedBigInteger(1) << 521) - UnsignedBigInteger(1);
+    const Montgomery *context = Montgomery::forModulus(modulus);
+    const UnsignedBigInteger base("48439561293906451759052585252797914202762949526041747995844080717082404635286");
+    const UnsignedBigInteger exponent = (modulus >> 3) + UnsignedBigInteger(12345);
+
+    EXPECT_EQ(naivePow(base, exponent, modulus), context->pow(base, exponent));
+    EXPECT_EQ(UnsignedBigInteger(1), context->pow(base, modulus - UnsignedBigInteger(1)));
+    if (context->limbs > Field::FIELD_LIMBS) {
+        EXPECT_THROW(context->powConstantTime(base, exponent), std::invalid_argument);
+    }
+}
+
+
+TEST(Exponentiation, p256Chains) {
+    const UnsignedBigInteger values[] = {
+            UnsignedBigInteger(1),
+            UnsignedBigInteger(2),
+            UnsignedBigInteger("48439561293906451759052585252797914202762949526041747995844080717082404635286"),
+            P256::m - UnsignedBigInteger(1)
+    };
+    const UnsignedBigInteger sqrtExponent = (P256::m + UnsignedBigInteger(1)) >> 2;
+
+    for (const Field *field : {static_cast<const Field *>(P256Field::instance()),
+                               static_cast<const Field *>(Montgomery::forModulus(P256::m))}) {
+        const FieldElement one(UnsignedBigInteger(1), field);
+
+        for (const UnsignedBigInteger &value : values) {
+            const FieldElement a(value, field);
+            const FieldElement inverse = Exponentiation::p256Inverse(a);
+            EXPECT_EQ(Exponentiation::slidingWindow(a, P256::m - UnsignedBigInteger(2)), inverse);
+            EXPECT_EQ(one, a * inverse);
+
+            const FieldElement root = Exponentiation::p256SquareRoot(a);
+            EXPECT_EQ(Exponentiation::slidingWindow(a, sqrtExponent), root);
+
+            // Squares always have a root, and -1 is not a square since p = 3 mod 4
+            EXPECT_EQ(a.square(), Exponentiation::p256SquareRoot(a.square()).square());
+            EXPECT_NE(-one, Exponentiation::p256SquareRoot(-one).square());
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/P256Field.h"
+#include "../../includes/ecc/FieldElement.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Montgomery;
+using ecc::P256Field;
+using ecc::Field;
+using ecc::FieldElement;
+
+
+TEST(FieldElement, conversion) {
+    const Montgomery *context = Montgomery::forModulus(UnsignedBigInteger(53));
+
+    for (UnsignedBigInteger j(0); j < 53; j++) {
+        EXPECT_EQ(j, FieldElement(j, context).toUnsigned());
+    }
+
+    EXPECT_EQ(UnsignedBigInteger(7), FieldElement(60, context).toUnsigned());
+}
+
+
+TEST(FieldElement, internedContext) {
+    const Montgomery *context = Montgomery::forModulus(UnsignedBigInteger(53));
+    EXPECT_EQ(context, Montgomery::forModulus(UnsignedBigInteger("53")));
+    EXPECT_NE(context, Montgomery::forModulus(UnsignedBigInteger(59)));
+    EXPECT_THROW(Montgomery::forModulus(UnsignedBigInteger(54)), std::invalid_argument);
+}
+
+
+TEST(FieldElement, arithmetic) {
+    const Montgomery *context = Montgomery::forModulus(
+            UnsignedBigInteger("95019687874943282453766626944185226110302651584829"));
+    FieldElement x(UnsignedBigInteger("74419310983787348047285639088879952108680136023207"), context);
+    FieldElement y(UnsignedBigInteger("74245211244475811723593504543727164879694968207507"), context);
+
+    EXPECT_EQ(UnsignedBigInteger("38183077291396469570854763072056246299650917983356"), (x * y).toUnsigned());
+    EXPECT_EQ(UnsignedBigInteger("53644834353319877317112516688421890878072452645885"), (x + y).toUnsigned());
+    EXPECT_EQ(UnsignedBigInteger("94845588135631746130074492399032438881317483769129"), (y - x).toUnsigned());
+    EXPECT_TRUE((x + -x).isZero());
+    EXPECT_EQ(x * y * (x * y), (x * y).square());
+}
+
+
+TEST(FieldElement, batchInvert) {
+    const Montgomery *context = Montgomery::forModulus(
+            UnsignedBigInteger("95019687874943282453766626944185226110302651584829"));
+    std::vector<FieldElement> elements;
+    for (unsigned i = 1; i <= 10; ++i) {
+        elements.emplace_back(UnsignedBigInteger("74419310983787348047285639088879952108680136023207") * i, context);
+    }
+
+    std::vector<FieldElement> inverses(elements);
+    FieldElement::batchInvert(inverses);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        EXPECT_EQ(elements[i].inverse(), inverses[i]);
+        EXPECT_TRUE((elements[i] * inverses[i]).isOne());
+    }
+
+    inverses[3] = FieldElement(UnsignedBigInteger(0), context);
+    EXPECT_THROW(FieldElement::batchInvert(inverses), std::domain_error);
+}
+
+
+TEST(FieldElement, sqrt) {
+    // 17 - 1 = 2^4: Tonelli-Shanks with the deepest 2-adic tower of the small primes
+    const Montgomery *small = Montgomery::forModulus(UnsignedBigInteger(17));
+    std::vector<bool> squares(17, false);
+    for (unsigned j = 0; j < 17; ++j) {
+        squares[j * j % 17] = true;
+    }
+    for (unsigned j = 0; j < 17; ++j) {
+        const FieldElement a(UnsignedBigInteger(j), small);
+        if (squares[j]) {
+            EXPECT_EQ(a, a.sqrt().square());
+        } else {
+            EXPECT_THROW(a.sqrt(), std::domain_error);
+        }
+    }
+
+    // 2^255 - 19 = 1 mod 4 (Tonelli-Shanks), the P-256 prime with both backends (addition chain)
+    const UnsignedBigInteger p25519 = (UnsignedBigInteger(1) << 255) - UnsignedBigInteger(19);
+    const UnsignedBigInteger p256("115792089210356248762697446949407573530086143415290314195533631308867097853951");
+    const Field *fields[] = {Montgomery::forModulus(p25519), Montgomery::forModulus(p256), P256Field::instance()};
+    const UnsignedBigInteger x("74419310983787348047285639088879952108680136023207");
+
+    for (const Field *field : fields) {
+        for (unsigned i = 1; i <= 5; ++i) {
+            const FieldElement a(x * i, field);
+            const FieldElement root = a.square().sqrt();
+            EXPECT_TRUE(root == a || root == -a);
+        }
+
+        // -1 is not a square modulo the P-256 prime, but is one modulo 2^255 - 19
+        const FieldElement minusOne = -FieldElement(UnsignedBigInteger(1), field);
+        if (field->modulus == p25519) {
+            EXPECT_EQ(minusOne, minusOne.sqrt().square());
+        } else {
+            EXPECT_THROW(minusOne.sqrt(), std::domain_error);
+        }
+    }
+}
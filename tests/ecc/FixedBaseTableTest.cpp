@@ -0,0 +1,93 @@
+#include <sstream>
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/FixedBaseTable.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Point;
+using ecc::FixedBaseTable;
+using ecc::P256;
+
+
+TEST(FixedBaseTable, multiply) {
+    UnsignedBigInteger k("91343852333181432387730302044767688728495783936");
+    UnsignedBigInteger n1 = P256::n - 1;
+
+    EXPECT_EQ(P256::generator * k, P256::multiplyGenerator(k));
+    EXPECT_EQ(P256::generator * n1, P256::multiplyGenerator(n1));
+    EXPECT_EQ(P256::generator * 15, P256::multiplyGenerator(15));
+    EXPECT_TRUE(P256::multiplyGenerator(0).isZero());
+    EXPECT_TRUE(P256::multiplyGenerator(P256::n).isZero());
+
+    // Scalars larger than the table fall back to the variable-base multiplication
+    UnsignedBigInteger large = P256::n * P256::n + 5;
+    EXPECT_EQ(P256::generator * 5, P256::multiplyGenerator(large));
+
+    FixedBaseTable narrow(P256::generator, 256, 3);
+    EXPECT_EQ(P256::generator * k, narrow.multiply(k));
+    EXPECT_EQ(P256::generator * n1, narrow.multiply(n1));
+
+    // An all-zero recoding gives the infinity of the curve, which supports further operations
+    const Point zero = narrow.multiply(0);
+    EXPECT_TRUE(zero.isZero());
+    EXPECT_EQ(P256::generator.curve, zero.curve);
+    EXPECT_EQ(P256::generator, zero + P256::generator);
+    EXPECT_EQ(P256::generator, zero.completeAdd(P256::generator));
+}
+
+
+TEST(FixedBaseTable, serialization) {
+    FixedBaseTable table(P256::generator, 64, 2);
+    std::stringstream stream;
+    table.save(stream);
+
+    FixedBaseTable loaded = FixedBaseTable::load(stream, P256::generator);
+    EXPECT_EQ(table.width, loaded.width);
+    EXPECT_EQ(table.bits, loaded.bits);
+    EXPECT_EQ(table.entries.size(), loaded.entries.size());
+
+    UnsignedBigInteger k("12345678901234567890");
+    EXPECT_EQ(P256::generator * k, loaded.multiply(k));
+
+    // Corrupted entries are rejected
+    std::string serialized = stream.str();
+    std::stringstream truncated(serialized.substr(0, serialized.size() / 2));
+    EXPECT_THROW(FixedBaseTable::load(truncated, P256::generator), std::invalid_argument);
+
+    std::stringstream wrongBase(serialized);
+    EXPECT_THROW(FixedBaseTable::load(wrongBase, P256::generator.twice()), std::invalid_argument);
+
+    std::string tampered = serialized;
+    tampered[tampered.find('\n') + 1] ^= 1;
+    std::stringstream tamperedStream(tampered);
+    EXPECT_THROW(FixedBaseTable::load(tamperedStream, P256::generator), std::invalid_argument);
+
+    // Entries on the curve but at the wrong place: the last two entries of the table are swapped
+    const size_t last = serialized.rfind('\n', serialized.size() - 2) + 1;
+    const size_t beforeLast = serialized.rfind('\n', last - 2) + 1;
+    const std::string swapped = serialized.substr(0, beforeLast) + serialized.substr(last)
+                                + serialized.substr(beforeLast, last - beforeLast);
+    std::stringstream swappedStream(swapped);
+    EXPECT_THROW(FixedBaseTable::load(swappedStream, P256::generator), std::invalid_argument);
+
+    // Negated entry, still on the curve
+    FixedBaseTable negated(P256::generator, 64, 2);
+    negated.entries[7] = -negated.entries[7];
+    std::stringstream negatedStream;
+    negated.save(negatedStream);
+    EXPECT_THROW(FixedBaseTable::load(negatedStream, P256::generator), std::invalid_argument);
+}
+
+
+TEST(FixedBaseTable, multiplyConstantTime) {
+    UnsignedBigInteger k("91343852333181432387730302044767688728495783936");
+    std::shared_ptr<const FixedBaseTable> table = P256::generatorTable();
+
+    EXPECT_EQ(P256::generator * k, table->multiplyConstantTime(k));
+    EXPECT_EQ(P256::generator * (P256::n - 1), table->multiplyConstantTime(P256::n - 1));
+    EXPECT_EQ(P256::generator, table->multiplyConstantTime(1));
+    EXPECT_TRUE(table->multiplyConstantTime(0).isZero());
+    EXPECT_THROW(table->multiplyConstantTime(P256::n * 2), std::invalid_argument);
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/FixedUnsignedInteger.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::FixedUnsignedInteger;
+
+typedef FixedUnsignedInteger<256 / UnsignedBigInteger::BITS> Fixed256;
+
+
+TEST(FixedUnsignedInteger, conversion) {
+    UnsignedBigInteger a("632858552968765207944109933559885181745442166904352723733773");
+    EXPECT_EQ(a, Fixed256(a).toUnsigned());
+    EXPECT_EQ(UnsignedBigInteger(0), Fixed256().toUnsigned());
+    EXPECT_THROW(Fixed256(UnsignedBigInteger(1) << 256), std::overflow_error);
+}
+
+
+TEST(FixedUnsignedInteger, comparison) {
+    constexpr Fixed256 a(12), b(13);
+    static_assert(a < b && b > a && a <= a && a != b, "comparisons must be usable in constant expressions");
+
+    Fixed256 c(UnsignedBigInteger("5206915870124834899065441625155476344422"));
+    EXPECT_TRUE(a < c);
+    EXPECT_FALSE(c < a);
+    EXPECT_TRUE(c == c);
+}
+
+
+TEST(FixedUnsignedInteger, addition) {
+    Fixed256 a(UnsignedBigInteger("5206915870124834899065441625155476344422"));
+    Fixed256 b(UnsignedBigInteger("632858552968765207938903017689760346846376725279197247389351"));
+    EXPECT_EQ(UnsignedBigInteger("632858552968765207944109933559885181745442166904352723733773"), (a + b).toUnsigned());
+
+    Fixed256 max(UnsignedBigInteger((UnsignedBigInteger(1) << 256) - 1));
+    EXPECT_EQ(1u, max.add(Fixed256(1)));
+    EXPECT_TRUE(max.isZero());
+}
+
+
+TEST(FixedUnsignedInteger, subtraction) {
+    Fixed256 a(UnsignedBigInteger("52069158701248348990694216690437672525441625155476344422"));
+    Fixed256 b(UnsignedBigInteger("632858552968765207938910791993355988518174547247389351"));
+    EXPECT_EQ(UnsignedBigInteger("51436300148279583782755305898444316536923450608228955071"), (a - b).toUnsigned());
+
+    Fixed256 zero;
+    EXPECT_EQ(1u, zero.subtract(Fixed256(1)));
+    EXPECT_EQ((UnsignedBigInteger(1) << 256) - 1, zero.toUnsigned());
+}
+
+
+TEST(FixedUnsignedInteger, multiplication) {
+    Fixed256 a(UnsignedBigInteger("520691587670793891079199525441622795837827553058984443165351554765290696344"));
+    Fixed256 b(UnsignedBigInteger("6328585520124834892421669043796873355988518174547247389351"));
+    EXPECT_EQ(a.toUnsigned() * b.toUnsigned(), (a * b).toUnsigned());
+
+    constexpr auto product = Fixed256(65536) * Fixed256(65536);
+    static_assert(product.digits.size() == 2 * Fixed256().digits.size(), "product is full-width");
+    EXPECT_EQ(UnsignedBigInteger(1) << 32, product.toUnsigned());
+}
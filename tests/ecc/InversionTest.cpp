@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Montgomery.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/Inversion.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Montgomery;
+using ecc::FieldElement;
+using ecc::Inversion;
+using ecc::P256;
+
+
+TEST(Inversion, smallModuli) {
+    for (const UnsignedBigInteger &prime : {UnsignedBigInteger(17), UnsignedBigInteger(23), UnsignedBigInteger(53)}) {
+        for (UnsignedBigInteger j(1); j < prime; j++) {
+            const UnsignedBigInteger expected = Montgomery::knuthModularInverse(j, prime);
+            EXPECT_EQ(expected, Inversion::binary(j, prime));
+            EXPECT_EQ(expected, Inversion::safegcd(j, prime));
+        }
+    }
+
+    // Composite modulus: only the values coprime with it are invertible
+    EXPECT_EQ(UnsignedBigInteger(13), Inversion::safegcd(UnsignedBigInteger(7), UnsignedBigInteger(15)));
+    EXPECT_THROW(Inversion::binary(UnsignedBigInteger(6), UnsignedBigInteger(15)), std::domain_error);
+    EXPECT_THROW(Inversion::safegcd(UnsignedBigInteger(6), UnsignedBigInteger(15)), std::domain_error);
+    EXPECT_THROW(Inversion::binary(UnsignedBigInteger(0), UnsignedBigInteger(17)), std::domain_error);
+    EXPECT_THROW(Inversion::safegcd(UnsignedBigInteger(0), UnsignedBigInteger(17)), std::domain_error);
+
+    // Even moduli fall back to the extended Euclid, and are rejected by safegcd
+    EXPECT_EQ(UnsignedBigInteger(7), Inversion::binary(UnsignedBigInteger(7), UnsignedBigInteger(16)));
+    EXPECT_THROW(Inversion::safegcd(UnsignedBigInteger(7), UnsignedBigInteger(16)), std::invalid_argument);
+}
+
+
+TEST(Inversion, p256) {
+    const UnsignedBigInteger values[] = {
+            UnsignedBigInteger(1),
+            UnsignedBigInteger(2),
+            P256::m - UnsignedBigInteger(1),
+            UnsignedBigInteger("48439561293906451759052585252797914202762949526041747995844080717082404635286"),
+            UnsignedBigInteger("36134250956749795798585127919587881956611106672985015071877198253568414405109")
+    };
+
+    for (const UnsignedBigInteger &modulus : {P256::m, P256::n}) {
+        for (const UnsignedBigInteger &value : values) {
+            const UnsignedBigInteger expected = Montgomery::knuthModularInverse(value, modulus);
+            EXPECT_EQ(expected, Inversion::binary(value, modulus));
+            EXPECT_EQ(expected, Inversion::safegcd(value, modulus));
+        }
+    }
+
+    for (const UnsignedBigInteger &value : values) {
+        const UnsignedBigInteger expected = Montgomery::knuthModularInverse(value, P256::m);
+        EXPECT_EQ(expected, Inversion::fermatP256(FieldElement(value, P256::context)).toUnsigned());
+        EXPECT_EQ(expected, Inversion::fermatP256(FieldElement(value, Montgomery::forModulus(P256::m))).toUnsigned());
+    }
+
+    EXPECT_THROW(Inversion::fermatP256(FieldElement(UnsignedBigInteger(0), P256::context)), std::domain_error);
+}
+
+
+TEST(Inversion, pseudoRandomValues) {
+    UnsignedBigInteger value("91343852333181432387730302044767688728495783936");
+
+    for (int i = 0; i < 200; ++i) {
+        value = (value * value + 7) % P256::n;
+        const UnsignedBigInteger inverse = Inversion::safegcd(value, P256::n);
+        EXPECT_EQ(inverse, Inversion::binary(value, P256::n));
+        EXPECT_EQ(UnsignedBigInteger(1), inverse * value % P256::n);
+    }
+}
+
+
+TEST(Inversion, fieldElementInverse) {
+    // Both backends map the inverse back to their representation
+    const UnsignedBigInteger value("36134250956749795798585127919587881956611106672985015071877198253568414405109");
+    const UnsignedBigInteger expected = Montgomery::knuthModularInverse(value, P256::m);
+
+    EXPECT_EQ(expected, FieldElement(value, P256::context).inverse().toUnsigned());
+    EXPECT_EQ(expected, FieldElement(value, Montgomery::forModulus(P256::m)).inverse().toUnsigned());
+    EXPECT_EQ(UnsignedBigInteger(9), FieldElement(UnsignedBigInteger(6), Montgomery::forModulus(53)).inverse().toUnsigned());
+}
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/JacobianPoint.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Point;
+using ecc::JacobianPoint;
+using ecc::P256;
+
+
+TEST(JacobianPoint, conversion) {
+    JacobianPoint g(P256::generator);
+    EXPECT_TRUE(g.aIsMinusThree);
+    EXPECT_EQ(P256::generator, g.toPoint());
+
+    Point g2 = P256::generator.twice(); // z != 1
+    EXPECT_EQ(g2, JacobianPoint(g2).toPoint());
+    EXPECT_TRUE(JacobianPoint(Point()).isZero());
+}
+
+
+TEST(JacobianPoint, twice) {
+    JacobianPoint g(P256::generator);
+    JacobianPoint generic(g);
+    generic.aIsMinusThree = false; // Force the generic doubling formula
+
+    EXPECT_EQ(P256::generator.twice(), g.twice().toPoint());
+    EXPECT_EQ(P256::generator.twice(), generic.twice().toPoint());
+    EXPECT_EQ(P256::generator.twice().twice(), g.twice().twice().toPoint());
+}
+
+
+TEST(JacobianPoint, addition) {
+    JacobianPoint g(P256::generator);
+    JacobianPoint g2 = g.twice();
+
+    EXPECT_EQ(P256::generator.twice() + P256::generator, (g2 + g).toPoint());
+    EXPECT_EQ(g2.toPoint(), (g + g).toPoint());
+    EXPECT_EQ(g.toPoint(), (g + JacobianPoint()).toPoint());
+}
+
+
+TEST(JacobianPoint, multiplication) {
+    JacobianPoint g(P256::generator);
+
+    EXPECT_EQ((g.twice() + g).toPoint(), (g * 3).toPoint());
+    EXPECT_TRUE((g * P256::n).isZero());
+    EXPECT_TRUE((g * 0).isZero());
+    EXPECT_EQ(P256::generator, (g * (P256::n + 1)).toPoint());
+}
+
+
+TEST(JacobianPoint, mixedAddition) {
+    JacobianPoint g(P256::generator);
+    JacobianPoint g3 = g.twice() + g;
+    JacobianPoint affine = g3.normalize();
+
+    EXPECT_TRUE(affine.z.isOne());
+    EXPECT_EQ(g3.toPoint(), affine.toPoint());
+    EXPECT_EQ((g3 + g.twice()).toPoint(), (g.twice().addAffine(affine)).toPoint());
+    EXPECT_EQ(g3.twice().toPoint(), JacobianPoint(g3).addAffine(affine).toPoint());
+    EXPECT_EQ(affine.toPoint(), JacobianPoint().addAffine(affine).toPoint());
+
+    std::vector<JacobianPoint> points = {g, g.twice(), g3, JacobianPoint()};
+    JacobianPoint::normalize(points);
+    EXPECT_EQ(g3.toPoint(), points[2].toPoint());
+    EXPECT_TRUE(points[1].z.isOne());
+    EXPECT_TRUE(points[3].isZero());
+}
+
+
+TEST(JacobianPoint, windowedMultiplication) {
+    UnsignedBigInteger k("91343852333181432387730302044767688728495783936");
+    UnsignedBigInteger n1 = P256::n - 1;
+
+    for (const JacobianPoint &base : {JacobianPoint(P256::generator), JacobianPoint(P256::generator).twice()}) {
+        // Reference double-and-add
+        JacobianPoint expected;
+        for (size_t bitIndex = k.getMostSignificantBitIndex(); bitIndex-- != 0;) {
+            expected = expected.twice();
+            if (k.getBit(bitIndex)) {
+                expected += base;
+            }
+        }
+
+        for (unsigned width = 2; width <= 8; ++width) {
+            EXPECT_EQ(expected.toPoint(), base.multiply(k, width).toPoint());
+            EXPECT_EQ((-base).toPoint(), base.multiply(n1, width).toPoint());
+        }
+    }
+}
+
+
+TEST(JacobianPoint, multiScalarMethods) {
+    std::vector<JacobianPoint> points = {JacobianPoint(P256::generator), JacobianPoint(P256::generator).twice(),
+                                         JacobianPoint(P256::generator * 5)};
+    std::vector<UnsignedBigInteger> scalars = {UnsignedBigInteger("91343852333181432387730302044767688728495783936"),
+                                               P256::n - 1, UnsignedBigInteger(3)};
+    JacobianPoint expected = points[0] * scalars[0] + points[1] * scalars[1];
+
+    EXPECT_EQ(expected.toPoint(), JacobianPoint::interleavedWnaf(std::span(points).first(2),
+                                                                 std::span(scalars).first(2)).toPoint());
+    EXPECT_EQ(expected.toPoint(), JacobianPoint::pippenger(std::span(points).first(2),
+                                                           std::span(scalars).first(2)).toPoint());
+
+    expected += points[2] * scalars[2];
+    for (unsigned width = 2; width <= 6; ++width) {
+        EXPECT_EQ(expected.toPoint(), JacobianPoint::interleavedWnaf(points, scalars, width).toPoint());
+    }
+    EXPECT_EQ(expected.toPoint(), JacobianPoint::pippenger(points, scalars).toPoint());
+}
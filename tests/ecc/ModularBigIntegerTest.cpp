@@ -56,3 +56,105 @@ TEST(ModularBigInteger, multplication) {
     c.value = "3027429495029888573836989950937185745280723518817";
     EXPECT_EQ(c, a * b);
 }
+
+
+TEST(ModularBigInteger, square) {
+    ModularBigInteger a("8730825963637287893941742967657970478242189027137",
+                        "10782148755896283475495548862133433546436570882721");
+    ModularBigInteger c("9907720398894867099870698277005043978058582511179",
+                        "10782148755896283475495548862133433546436570882721");
+    EXPECT_EQ(c, a.square());
+    EXPECT_EQ(c, a * a);
+}
+
+
+TEST(ModularBigInteger, squareMatchesMultiplication) {
+    const UnsignedBigInteger a("8730825963637287893941742967657970478242189027137");
+    for (const char *modulus : {"10782148755896283475495548862133433546436570882721",
+                                "10782148755896283475495548862133433546436570882720",
+                                "115792089210356248762697446949407573530086143415290314195533631308867097853951",
+                                "1000003", "1024"}) {
+        const ModularBigInteger x(a, UnsignedBigInteger(modulus));
+        const ModularBigInteger y(x);
+        EXPECT_EQ(x * y, x.square()) << modulus;
+
+        ModularBigInteger z(x);
+        z *= z;
+        EXPECT_EQ(x * y, z) << modulus;
+    }
+}
+
+
+TEST(ModularBigInteger, batchInvert) {
+    const std::string modulus = "10782148755896283475495548862133433546436570882721";
+    std::vector<ModularBigInteger> values = {
+            ModularBigInteger("8730825963637287893941742967657970478242189027137", modulus),
+            ModularBigInteger("3984832838684800479389379089880937378939039739393", modulus),
+            ModularBigInteger("1", modulus),
+            ModularBigInteger("2", modulus)
+    };
+    const std::vector<ModularBigInteger> original(values);
+    const ModularBigInteger one("1", modulus);
+
+    ModularBigInteger::batchInvert(values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(one, original[i] * values[i]);
+    }
+
+    std::vector<ModularBigInteger> single = {ModularBigInteger("12", "23")};
+    ModularBigInteger::batchInvert(single);
+    EXPECT_EQ(ModularBigInteger("2", "23"), single[0]);
+
+    std::vector<ModularBigInteger> withZero = {ModularBigInteger("12", "23"), ModularBigInteger("0", "23")};
+    EXPECT_THROW(ModularBigInteger::batchInvert(withZero), std::domain_error);
+    std::vector<ModularBigInteger> mixed = {ModularBigInteger("12", "23"), ModularBigInteger("12", "29")};
+    EXPECT_THROW(ModularBigInteger::batchInvert(mixed), std::invalid_argument);
+
+    std::vector<ModularBigInteger> empty;
+    EXPECT_NO_THROW(ModularBigInteger::batchInvert(empty));
+}
+
+
+TEST(ModularBigInteger, sqrt) {
+    for (const UnsignedBigInteger &modulus : {UnsignedBigInteger(53), UnsignedBigInteger(59)}) {
+        for (UnsignedBigInteger j(0); j < modulus; j++) {
+            const ModularBigInteger a(j, modulus);
+            const ModularBigInteger root = a.square().sqrt();
+            EXPECT_EQ(a.square(), root.square());
+        }
+    }
+
+    // 2 is not a square modulo 53 nor 59
+    EXPECT_THROW(ModularBigInteger(UnsignedBigInteger(2), UnsignedBigInteger(53)).sqrt(), std::domain_error);
+    EXPECT_THROW(ModularBigInteger(UnsignedBigInteger(2), UnsignedBigInteger(59)).sqrt(), std::domain_error);
+}
+
+
+TEST(ModularBigInteger, evenModulus) {
+    const std::string modulus = "10782148755896283475495548862133433546436570882720";
+    const UnsignedBigInteger a("8730825963637287893941742967657970478242189027137");
+    const UnsignedBigInteger b("3984832838684800479389379089880937378939039739393");
+    const UnsignedBigInteger m(modulus);
+
+    EXPECT_EQ(ModularBigInteger((a * b) % m, m), ModularBigInteger(a, m) * ModularBigInteger(b, m));
+    EXPECT_EQ(ModularBigInteger(a.square() % m, m), ModularBigInteger(a, m).square());
+    EXPECT_EQ(ModularBigInteger(UnsignedBigInteger(1), UnsignedBigInteger(100)),
+              ModularBigInteger("7", "100").pow(UnsignedBigInteger(4)));
+    EXPECT_EQ(ModularBigInteger(a * a % m * a % m, m), ModularBigInteger(a, m).pow(UnsignedBigInteger(3)));
+    EXPECT_EQ(ModularBigInteger("1", modulus), ModularBigInteger(a, m).pow(UnsignedBigInteger(0)));
+    EXPECT_THROW(ModularBigInteger("4", "100").sqrt(), std::invalid_argument);
+}
+
+
+TEST(ModularBigInteger, manyModuli) {
+    // More moduli than cached contexts, interleaved so that each context is evicted then rebuilt
+    for (int round = 0; round < 3; ++round) {
+        for (Digit modulus = 1001; modulus < 1001 + 2 * 10; modulus += 2) {
+            const ModularBigInteger a(UnsignedBigInteger(modulus - 2), UnsignedBigInteger(modulus));
+            EXPECT_EQ(ModularBigInteger(UnsignedBigInteger(4), UnsignedBigInteger(modulus)), a * a);
+            EXPECT_EQ(ModularBigInteger(UnsignedBigInteger(4), UnsignedBigInteger(modulus)), a.square());
+            EXPECT_EQ(ModularBigInteger(UnsignedBigInteger(modulus - 8), UnsignedBigInteger(modulus)),
+                      a.pow(UnsignedBigInteger(3)));
+        }
+    }
+}
@@ -50,4 +50,70 @@ TEST(Montgomery, montgomeryMultiplicationHardcore) {
     Montgomery montgomery(m);
 
     EXPECT_EQ(r, montgomery.multiplication(x, y));
-}
\ No newline at end of file
+}
+
+TEST(Montgomery, multiplyInPlace) {
+    UnsignedBigInteger m, x, y;
+    m = "115792089210356248762697446949407573530086143415290314195533631308867097853951";
+    x = "48439561293906451759052585252797914202762949526041747995844080717082404635286";
+    y = "36134250956749795798585127919587881956611106672985015071877198253568414405109";
+
+    Montgomery montgomery(m);
+    Digits a(x.digits), scratch(montgomery.limbs + 2);
+
+    Montgomery::multiply(a.data(), a.data(), y.digits.data(), m.digits.data(), montgomery.invN, montgomery.limbs,
+                         scratch.data());
+
+    EXPECT_EQ(montgomery.montgomeryRef(x, y), UnsignedBigInteger(a));
+}
+
+
+TEST(Montgomery, threeAddress) {
+    UnsignedBigInteger m, x, y;
+    m = "115792089210356248762697446949407573530086143415290314195533631308867097853951";
+    x = "48439561293906451759052585252797914202762949526041747995844080717082404635286";
+    y = "36134250956749795798585127919587881956611106672985015071877198253568414405109";
+
+    Montgomery montgomery(m);
+    UnsignedBigInteger out;
+    Digits scratch;
+
+    montgomery.montgomery(out, x, y, scratch);
+    EXPECT_EQ(montgomery.montgomeryRef(x, y), out);
+    montgomery.multiplication(out, x, y, scratch);
+    EXPECT_EQ(x * y % m, out);
+
+    // Aliased and unreduced operands
+    UnsignedBigInteger z = x;
+    montgomery.multiplication(z, z, y + m, scratch);
+    EXPECT_EQ(x * y % m, z);
+    montgomery.montgomery(z, z, z, scratch);
+    EXPECT_EQ(montgomery.montgomeryRef(x * y % m, x * y % m), z);
+
+    // Small results are trimmed
+    montgomery.multiplication(out, m - 1, m - 1, scratch);
+    EXPECT_EQ(UnsignedBigInteger(1), out);
+
+    // The output keeps its storage from one call to the next
+    const Digit *data = out.digits.data();
+    for (int i = 0; i < 4; ++i) {
+        montgomery.multiplication(out, x, y, scratch);
+    }
+    EXPECT_EQ(data, out.digits.data());
+}
+
+
+TEST(Montgomery, square) {
+    UnsignedBigInteger m, x;
+    m = "115792089210356248762697446949407573530086143415290314195533631308867097853951";
+    x = "48439561293906451759052585252797914202762949526041747995844080717082404635286";
+
+    Montgomery montgomery(m);
+    EXPECT_EQ(montgomery.montgomeryRef(x, x), montgomery.montgomerySquare(x));
+    EXPECT_EQ(montgomery.montgomeryRef(m - 1, m - 1), montgomery.montgomerySquare(m - 1));
+
+    Montgomery small(53);
+    for (UnsignedBigInteger j(0); j < 53; j++) {
+        EXPECT_EQ(small.montgomeryRef(j, j), small.montgomerySquare(j));
+    }
+}
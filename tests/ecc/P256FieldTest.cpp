@@ -0,0 +1,54 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/FieldElement.h"
+#include "../../includes/ecc/P256Field.h"
+#include "../../includes/ecc/Curve.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::FieldElement;
+using ecc::P256Field;
+using ecc::Curve;
+using ecc::Point;
+using ecc::P256;
+
+
+TEST(P256Field, reduction) {
+    const P256Field *field = P256Field::instance();
+    std::mt19937_64 generator(256);
+    std::vector<UnsignedBigInteger> values = {0, 1, 2, P256::m - 1, P256::m - 2};
+
+    for (size_t i = 0; i < 50; ++i) {
+        Digits digits(256 / UnsignedBigInteger::BITS);
+        for (Digit &digit : digits) {
+            digit = static_cast<Digit>(generator());
+        }
+        values.push_back(UnsignedBigInteger(digits) % P256::m);
+    }
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        const UnsignedBigInteger &a = values[i], &b = values[(i * 7 + 3) % values.size()];
+        FieldElement x(a, field), y(b, field);
+
+        EXPECT_EQ(a * b % P256::m, (x * y).toUnsigned());
+        EXPECT_EQ(a * a % P256::m, x.square().toUnsigned());
+        EXPECT_EQ((a + b) % P256::m, (x + y).toUnsigned());
+    }
+}
+
+
+TEST(P256Field, pointArithmetic) {
+    const Curve *curve = Curve::forParameters(P256::a.value, P256::b.value, P256Field::instance());
+    Point g(P256::generator.x.toUnsigned(), P256::generator.y.toUnsigned(), UnsignedBigInteger(1), curve);
+    UnsignedBigInteger k("91343852333181432387730302044767688728495783936");
+
+    EXPECT_TRUE(g.isOnCurve());
+    EXPECT_TRUE(curve->aIsMinusThree);
+    EXPECT_TRUE((g * P256::n).isZero());
+
+    Point expected = (P256::generator * k).normalize(), actual = (g * k).normalize();
+    EXPECT_EQ(expected.x.toUnsigned(), actual.x.toUnsigned());
+    EXPECT_EQ(expected.y.toUnsigned(), actual.y.toUnsigned());
+}
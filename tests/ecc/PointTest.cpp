@@ -0,0 +1,291 @@
+#include "gtest/gtest.h"
+#include "../../includes/ecc/UnsignedBigInteger.h"
+#include "../../includes/ecc/Point.h"
+#include "../../includes/ecc/P256.h"
+
+using ecc::UnsignedBigInteger;
+using ecc::Point;
+using ecc::P256;
+
+
+TEST(Point, generatorIsOnCurve) {
+    EXPECT_TRUE(P256::generator.isOnCurve());
+}
+
+
+TEST(Point, twice) {
+    Point expected(
+            UnsignedBigInteger("56515219790691171413109057904011688695424810155802929973526481321309856242040"),
+            UnsignedBigInteger("3377031843712258259223711451491452598088675519751548567112458094635497583569"),
+            UnsignedBigInteger(1),
+            P256::a.value,
+            P256::b.value,
+            P256::context
+    );
+
+    EXPECT_EQ(expected, P256::generator.twice());
+    EXPECT_EQ(expected, P256::generator + P256::generator);
+    EXPECT_EQ(expected, P256::generator * 2);
+    EXPECT_TRUE(P256::generator.twice().isOnCurve());
+}
+
+
+TEST(Point, multiplication) {
+    Point g3 = P256::generator.twice() + P256::generator;
+    EXPECT_EQ(g3, P256::generator * 3);
+    EXPECT_EQ(P256::generator, g3 - P256::generator.twice());
+    EXPECT_TRUE((P256::generator * P256::n).isZero());
+    EXPECT_EQ(P256::generator, P256::generator * (P256::n + 1));
+}
+
+
+TEST(Point, infinity) {
+    const Point g = P256::generator, atInfinity = g * P256::n;
+
+    // Products at infinity stay bound to the curve, and go through the point formulas
+    EXPECT_TRUE(atInfinity.isZero());
+    EXPECT_EQ(g.curve, atInfinity.curve);
+    EXPECT_TRUE((g * 0).isZero());
+    EXPECT_FALSE(atInfinity.isOnCurve());
+    EXPECT_FALSE(Point().isOnCurve());
+    EXPECT_TRUE(atInfinity.twice().isZero());
+
+    EXPECT_EQ(g, g - atInfinity);
+    EXPECT_EQ(g, g - g * 0);
+    EXPECT_EQ(g, g - Point());
+    EXPECT_EQ(g * (P256::n - 1), g * 0 - g);
+    EXPECT_EQ(g * (P256::n - 1), Point() - g);
+    EXPECT_TRUE((atInfinity - atInfinity).isZero());
+    EXPECT_EQ(g * 3, (atInfinity + g) * 3);
+    EXPECT_TRUE((atInfinity * 5).isZero());
+}
+
+
+TEST(Point, normalize) {
+    Point g2 = P256::generator.twice();
+    Point affine = g2.normalize();
+    EXPECT_TRUE(affine.z.isOne());
+    EXPECT_EQ(g2, affine);
+
+    std::vector<Point> points = {g2, g2 + P256::generator, Point()};
+    Point::normalize(points);
+    EXPECT_EQ(g2 + P256::generator, points[1]);
+    EXPECT_TRUE(points[1].z.isOne());
+    EXPECT_TRUE(points[2].isZero());
+}
+
+
+TEST(Point, internedCurve) {
+    Point g(
+            UnsignedBigInteger("48439561293906451759052585252797914202762949526041747995844080717082404635286"),
+            UnsignedBigInteger("36134250956749795798585127919587881956611106672985015071877198253568414405109"),
+            UnsignedBigInteger(1),
+            P256::a.value,
+            P256::b.value,
+            P256::context
+    );
+
+    EXPECT_EQ(P256::generator.curve, g.curve);
+    EXPECT_EQ(P256::context, g.curve->field);
+    EXPECT_TRUE(g.curve->aIsMinusThree);
+    EXPECT_EQ(P256::generator, g);
+
+    // A bare modulus selects the interned Montgomery backend
+    const ecc::Curve *montgomeryCurve = ecc::Curve::forParameters(P256::a.value, P256::b.value, P256::m);
+    EXPECT_EQ(ecc::Montgomery::forModulus(P256::m), montgomeryCurve->field);
+    EXPECT_EQ(montgomeryCurve, ecc::Curve::forParameters(P256::a.value, P256::b.value, P256::m));
+}
+
+
+TEST(Point, completeAdd) {
+    Point g = P256::generator, g2 = P256::generator.twice(), infinity = g - g;
+
+    EXPECT_EQ(g2 + g, g2.completeAdd(g));
+    EXPECT_EQ(g2, g.completeAdd(g));
+    EXPECT_TRUE(g.completeAdd(g * (P256::n - 1)).isZero());
+    EXPECT_EQ(g, g.completeAdd(infinity));
+    EXPECT_EQ(g2, infinity.completeAdd(g2));
+    EXPECT_TRUE(infinity.completeAdd(infinity).isZero());
+
+    // The other forms of the point at infinity, as the receiver and as the argument
+    const Point atInfinity[] = {g * P256::n, g * 0, Point(), Point(UnsignedBigInteger(5), UnsignedBigInteger(0),
+                                                                   UnsignedBigInteger(0), g.curve)};
+    for (const Point &zero : atInfinity) {
+        EXPECT_EQ(g, g.completeAdd(zero));
+        EXPECT_EQ(g2, zero.completeAdd(g2));
+        EXPECT_TRUE(zero.completeAdd(zero).isZero());
+        EXPECT_TRUE(zero.completeAdd(infinity).isZero());
+        EXPECT_EQ(g2, zero.completeAdd(g).completeAdd(g));
+    }
+}
+
+
+TEST(Point, ladder) {
+    UnsignedBigInteger k("91343852333181432387730302044767688728495783936");
+    Point g2 = P256::generator.twice(); // z != 1
+
+    for (const UnsignedBigInteger &scalar : {k, P256::n - 1, UnsignedBigInteger(1), UnsignedBigInteger(2)}) {
+        EXPECT_EQ(P256::generator * scalar, P256::generator.ladder(scalar));
+        EXPECT_EQ(g2 * scalar, g2.ladder(scalar));
+    }
+
+    EXPECT_TRUE(P256::generator.ladder(0).isZero());
+    EXPECT_TRUE(P256::generator.ladder(P256::n).isZero());
+
+    // Points at infinity, and a scalar above the order
+    EXPECT_TRUE((P256::generator * P256::n).ladder(k).isZero());
+    EXPECT_EQ(P256::generator.curve, (P256::generator * P256::n).ladder(k).curve);
+    EXPECT_TRUE(Point().ladder(k).isZero());
+    EXPECT_EQ(P256::generator * k, P256::generator.ladder(P256::n + k));
+}
+
+
+TEST(Point, multiScalarMul) {
+    std::vector<Point> points;
+    std::vector<UnsignedBigInteger> scalars;
+    Point base = P256::generator, expected = P256::generator - P256::generator;
+    UnsignedBigInteger scalar("91343852333181432387730302044767688728495783936");
+
+    EXPECT_TRUE(Point::multiScalarMul(points, scalars).isZero());
+
+    // Interleaved wNAF (with affine tables from 8 terms), then Pippenger
+    for (size_t count = 1; count <= Point::PIPPENGER_THRESHOLD + 2; ++count) {
+        points.push_back(base);
+        scalars.push_back(count == 3 ? UnsignedBigInteger(0) : scalar);
+        expected += base * scalars.back();
+
+        if (count <= 4 || count == 16 || count == Point::PIPPENGER_THRESHOLD + 2) {
+            EXPECT_EQ(expected, Point::multiScalarMul(points, scalars));
+        }
+
+        base = base.twice() + P256::generator;
+        scalar = (scalar * scalar + 7) % P256::n;
+    }
+
+    // Opposite terms cancel out
+    std::vector<Point> opposite = {P256::generator, P256::generator * (P256::n - 1)};
+    std::vector<UnsignedBigInteger> same = {scalar, scalar};
+    EXPECT_TRUE(Point::multiScalarMul(opposite, same).isZero());
+
+    // Terms at infinity are skipped, whether they are bound to the curve or not, with all the methods
+    for (size_t count : {size_t(2), size_t(10), points.size()}) {
+        std::vector<Point> someAtInfinity(points.begin(), points.begin() + count);
+        std::vector<UnsignedBigInteger> someScalars(scalars.begin(), scalars.begin() + count);
+        const Point sum = Point::multiScalarMul(someAtInfinity, someScalars);
+
+        someAtInfinity.insert(someAtInfinity.begin(), Point());
+        someScalars.insert(someScalars.begin(), scalar);
+        someAtInfinity.push_back(P256::generator * 0);
+        someScalars.push_back(scalar);
+        someAtInfinity.push_back(P256::generator * P256::n);
+        someScalars.push_back(UnsignedBigInteger(0));
+        EXPECT_EQ(sum, Point::multiScalarMul(someAtInfinity, someScalars));
+    }
+
+    std::vector<Point> allAtInfinity = {Point(), P256::generator * P256::n, P256::generator};
+    std::vector<UnsignedBigInteger> anyScalars = {scalar, scalar, UnsignedBigInteger(0)};
+    EXPECT_TRUE(Point::multiScalarMul(allAtInfinity, anyScalars).isZero());
+
+    scalars.pop_back();
+    EXPECT_THROW(Point::multiScalarMul(points, scalars), std::invalid_argument);
+}
+
+
+TEST(Point, compress) {
+    const ecc::Curve *montgomeryCurve = ecc::Curve::forParameters(P256::a.value, P256::b.value, P256::m);
+    Point g2 = P256::generator.twice(); // z != 1
+
+    for (const Point &point : {P256::generator, g2, P256::generator * 5 - g2, P256::generator * (P256::n - 1)}) {
+        const std::vector<uint8_t> encoded = point.compress();
+        EXPECT_EQ(33, encoded.size());
+        EXPECT_EQ(point, Point::decompress(encoded, point.curve));
+
+        // The same point over the Montgomery backend
+        const Point decoded = Point::decompress(encoded, montgomeryCurve);
+        EXPECT_EQ(point.normalize().x.toUnsigned(), decoded.x.toUnsigned());
+        EXPECT_EQ(point.normalize().y.toUnsigned(), decoded.y.toUnsigned());
+    }
+
+    // Point at infinity
+    const Point infinity = P256::generator - P256::generator;
+    EXPECT_EQ(std::vector<uint8_t>{0x00}, infinity.compress());
+    EXPECT_TRUE(Point::decompress(infinity.compress(), P256::generator.curve).isZero());
+
+    // Malformed encodings, and abscissas out of range or off the curve
+    std::vector<uint8_t> encoded = P256::generator.compress();
+    std::vector<uint8_t> badPrefix(encoded), notReduced(33, 0xff);
+    badPrefix[0] = 0x04;
+    notReduced[0] = 0x02;
+    EXPECT_THROW(Point::decompress(badPrefix, P256::generator.curve), std::invalid_argument);
+    EXPECT_THROW(Point::decompress(notReduced, P256::generator.curve), std::invalid_argument);
+    EXPECT_THROW(Point::decompress(std::span(encoded).first(32), P256::generator.curve), std::invalid_argument);
+
+    // About half of the abscissas are off the curve
+    size_t offCurve = 0;
+    for (uint8_t last = 0; last < 16; ++last) {
+        std::vector<uint8_t> candidate(encoded);
+        candidate[32] = last;
+        try {
+            Point::decompress(candidate, P256::generator.curve);
+        } catch (const std::invalid_argument &) {
+            ++offCurve;
+        }
+    }
+    EXPECT_GT(offCurve, 0);
+    EXPECT_LT(offCurve, 16);
+}
+
+
+TEST(Point, decompressSmallCurve) {
+    // y^2 = x^3 + 2x + 2 over F_17 has 19 points, 17 = 1 mod 4 needs Tonelli-Shanks
+    const ecc::Curve *curve = ecc::Curve::forParameters(UnsignedBigInteger(2), UnsignedBigInteger(2),
+                                                        UnsignedBigInteger(17));
+    size_t count = 1;
+
+    for (uint8_t x = 0; x < 17; ++x) {
+        for (uint8_t prefix : {0x02, 0x03}) {
+            const uint8_t encoded[] = {prefix, x};
+            try {
+                const Point point = Point::decompress(encoded, curve);
+                EXPECT_TRUE(point.isOnCurve());
+                EXPECT_EQ(std::vector<uint8_t>(encoded, encoded + 2), point.compress());
+                ++count;
+            } catch (const std::invalid_argument &) {
+            }
+        }
+    }
+
+    EXPECT_EQ(19, count);
+}
+
+
+TEST(Point, encode) {
+    const Point g2 = P256::generator.twice(); // z != 1
+    const std::string expected = "047cf27b188d034f7e8a52380304b51ac3c08969e277f21b35a60b48fc47669978"
+                                 "07775510db8ed040293d9ac69f7430dbba7dade63ce982299e04b79d227873d1";
+    uint8_t buffer[80] = {};
+
+    EXPECT_EQ(65, Point::encodedSize(g2.curve, false));
+    EXPECT_EQ(33, Point::encodedSize(g2.curve, true));
+    EXPECT_EQ(65, g2.encode(buffer, false));
+    EXPECT_EQ(UnsignedBigInteger::fromHex(expected), UnsignedBigInteger::fromBytes(std::span(buffer).first(65)));
+    EXPECT_EQ(g2, Point::decode(std::span(buffer).first(65), g2.curve));
+
+    EXPECT_EQ(33, g2.encode(buffer, true));
+    EXPECT_EQ(0x03, buffer[0]);
+    EXPECT_EQ(g2, Point::decode(std::span(buffer).first(33), g2.curve));
+
+    const Point infinity = P256::generator - P256::generator;
+    EXPECT_EQ(1, infinity.encode(buffer, false));
+    EXPECT_TRUE(Point::decode(std::span(buffer).first(1), g2.curve).isZero());
+    EXPECT_THROW(g2.encode(std::span(buffer).first(64), false), std::overflow_error);
+
+    // Off the curve, not reduced, and truncated encodings
+    g2.encode(buffer, false);
+    buffer[64] ^= 1;
+    EXPECT_THROW(Point::decode(std::span(buffer).first(65), g2.curve), std::invalid_argument);
+    std::fill(buffer + 1, buffer + 33, 0xff);
+    EXPECT_THROW(Point::decode(std::span(buffer).first(65), g2.curve), std::invalid_argument);
+    EXPECT_THROW(Point::decode(std::span(buffer).first(64), g2.curve), std::invalid_argument);
+    EXPECT_THROW(Point::decode(std::span<const uint8_t>(), g2.curve), std::invalid_argument);
+}
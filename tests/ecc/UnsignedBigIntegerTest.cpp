@@ -1,8 +1,19 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "../../includes/ecc/UnsignedBigInteger.h"
 
 using ecc::UnsignedBigInteger;
 
+static UnsignedBigInteger randomUnsignedBigInteger(std::mt19937_64 &generator, size_t size) {
+    Digits digits(size);
+    for (Digit &digit : digits) {
+        digit = static_cast<Digit>(generator());
+    }
+    digits.back() |= 1; // Keep the requested size
+
+    return UnsignedBigInteger(digits);
+}
+
 TEST(UnsignedBigIntegerTest, addition) {
     UnsignedBigInteger a, b, c;
     a = 12;
@@ -41,4 +52,221 @@ TEST(UnsignedBigIntegerTest, multiplication) {
     b = "6328585520124834892421669043796873355988518174547247389351";
     c = "3295241242184197224320030900734076779249975516912524640613078849244426367791308551622519659152149227496619025568820747648521818631050122";
     EXPECT_EQ(c, a * b);
-}
\ No newline at end of file
+}
+
+
+TEST(UnsignedBigIntegerTest, fastMultiplication) {
+    std::mt19937_64 generator(42);
+    const size_t sizes[][2] = {{100, 100}, {101, 57}, {400, 400}, {523, 170}, {900, 40}};
+
+    for (const auto &size : sizes) {
+        UnsignedBigInteger a = randomUnsignedBigInteger(generator, size[0]);
+        UnsignedBigInteger b = randomUnsignedBigInteger(generator, size[1]);
+        UnsignedBigInteger expected = UnsignedBigInteger::schoolbookMultiply(a, b);
+
+        EXPECT_EQ(expected, UnsignedBigInteger::karatsubaMultiply(a, b));
+        EXPECT_EQ(expected, UnsignedBigInteger::karatsubaMultiply(b, a));
+        EXPECT_EQ(expected, UnsignedBigInteger::toom3Multiply(a, b));
+        EXPECT_EQ(expected, UnsignedBigInteger::toom3Multiply(b, a));
+        EXPECT_EQ(expected, a * b);
+    }
+}
+
+
+TEST(UnsignedBigIntegerTest, square) {
+    UnsignedBigInteger a;
+    a = "520691587670793891079199525441622795837827553058984443165351554765290696344422";
+    EXPECT_EQ(a * a, a.square());
+    EXPECT_EQ(UnsignedBigInteger(0), UnsignedBigInteger(0).square());
+
+    std::mt19937_64 generator(7);
+    for (size_t size : {1, 2, 17, 90, 301, 700}) {
+        a = randomUnsignedBigInteger(generator, size);
+        UnsignedBigInteger expected = UnsignedBigInteger::schoolbookMultiply(a, a);
+
+        EXPECT_EQ(expected, UnsignedBigInteger::schoolbookSquare(a));
+        EXPECT_EQ(expected, UnsignedBigInteger::karatsubaSquare(a));
+        EXPECT_EQ(expected, UnsignedBigInteger::toom3Square(a));
+        EXPECT_EQ(expected, a.square());
+    }
+}
+
+
+TEST(UnsignedBigIntegerTest, threeAddress) {
+    std::mt19937_64 generator(11);
+    UnsignedBigInteger out;
+    Digits scratch;
+
+    for (size_t size : {2, 3, 8, 40, 120}) {
+        const UnsignedBigInteger a = randomUnsignedBigInteger(generator, size);
+        const UnsignedBigInteger b = randomUnsignedBigInteger(generator, size / 2); // Shorter, hence lower than a
+
+        UnsignedBigInteger::add(out, a, b);
+        EXPECT_EQ(a + b, out);
+        UnsignedBigInteger::subtract(out, a, b);
+        EXPECT_EQ(a - b, out);
+        UnsignedBigInteger::multiply(out, a, b, scratch);
+        EXPECT_EQ(a * b, out);
+        UnsignedBigInteger::square(out, a, scratch);
+        EXPECT_EQ(a.square(), out);
+
+        // The output may alias the operands
+        UnsignedBigInteger x = a;
+        UnsignedBigInteger::add(x, x, x);
+        EXPECT_EQ(a + a, x);
+        UnsignedBigInteger::subtract(x, x, a);
+        EXPECT_EQ(a, x);
+        UnsignedBigInteger::multiply(x, b, x, scratch);
+        EXPECT_EQ(a * b, x);
+        UnsignedBigInteger::subtract(x, x, x);
+        EXPECT_EQ(UnsignedBigInteger(0), x);
+    }
+
+    // Carries and borrows through the whole number
+    const UnsignedBigInteger max = (UnsignedBigInteger(1) << 256) - UnsignedBigInteger(1);
+    UnsignedBigInteger::add(out, max, UnsignedBigInteger(1));
+    EXPECT_EQ(UnsignedBigInteger(1) << 256, out);
+    UnsignedBigInteger::subtract(out, out, UnsignedBigInteger(1));
+    EXPECT_EQ(max, out);
+    EXPECT_THROW(UnsignedBigInteger::subtract(out, UnsignedBigInteger(1), max), std::underflow_error);
+
+    // Once the buffers are large enough, the output and the scratch swap their storage without reallocating
+    const UnsignedBigInteger a = randomUnsignedBigInteger(generator, 16), b = randomUnsignedBigInteger(generator, 16);
+    UnsignedBigInteger::multiply(out, a, b, scratch);
+    UnsignedBigInteger::multiply(out, a, b, scratch);
+    const Digit *buffers[] = {out.digits.data(), scratch.data()};
+    for (int i = 0; i < 4; ++i) {
+        UnsignedBigInteger::multiply(out, a, b, scratch);
+        EXPECT_EQ(buffers[(i + 1) % 2], out.digits.data());
+        EXPECT_EQ(buffers[i % 2], scratch.data());
+    }
+    EXPECT_EQ(a * b, out);
+}
+
+
+TEST(UnsignedBigIntegerTest, nonAdjacentForm) {
+    std::mt19937_64 generator(9);
+
+    for (unsigned width = 2; width <= 8; ++width) {
+        for (size_t size : {1, 2, 5, 9}) {
+            UnsignedBigInteger k = randomUnsignedBigInteger(generator, size);
+            std::vector<int8_t> naf = k.getNonAdjacentForm(width);
+
+            // Rebuild the integer as (sum of positive digits) - (sum of negative digits)
+            UnsignedBigInteger positive, negative;
+            size_t lastNonZero = 0;
+            bool first = true;
+            for (size_t i = naf.size(); i-- != 0;) {
+                positive = positive + positive;
+                negative = negative + negative;
+
+                if (naf[i] == 0) {
+                    continue;
+                }
+
+                EXPECT_EQ(1, naf[i] & 1);
+                EXPECT_LT(std::abs(naf[i]), 1 << (width - 1));
+                EXPECT_TRUE(first || lastNonZero - i >= width);
+                lastNonZero = i;
+                first = false;
+
+                if (naf[i] > 0) {
+                    positive = positive + UnsignedBigInteger(naf[i]);
+                } else {
+                    negative = negative + UnsignedBigInteger(-naf[i]);
+                }
+            }
+
+            EXPECT_EQ(k, positive - negative);
+        }
+    }
+
+    EXPECT_TRUE(UnsignedBigInteger(0).getNonAdjacentForm(4).empty());
+    EXPECT_THROW(UnsignedBigInteger(1).getNonAdjacentForm(1), std::invalid_argument);
+}
+
+
+TEST(UnsignedBigIntegerTest, bytes) {
+    const std::vector<uint8_t> bytes = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a};
+    UnsignedBigInteger value = UnsignedBigInteger::fromBytes(bytes);
+    EXPECT_EQ(UnsignedBigInteger("4759477275222530853130"), value);
+
+    std::vector<uint8_t> output(bytes.size());
+    value.toBytes(output);
+    EXPECT_EQ(bytes, output);
+
+    std::vector<uint8_t> tooShort(9);
+    EXPECT_THROW(value.toBytes(tooShort), std::overflow_error);
+    EXPECT_EQ(UnsignedBigInteger(0), UnsignedBigInteger::fromBytes(std::span<const uint8_t>()));
+}
+
+
+TEST(UnsignedBigIntegerTest, hex) {
+    const UnsignedBigInteger value("4759477275222530853130");
+    EXPECT_EQ(value, UnsignedBigInteger::fromHex("0102030405060708090a"));
+    EXPECT_EQ(value, UnsignedBigInteger::fromHex("000102030405060708090A"));
+    EXPECT_EQ("102030405060708090a", value.toHex());
+    EXPECT_EQ("0", UnsignedBigInteger(0).toHex());
+    EXPECT_EQ(UnsignedBigInteger(0), UnsignedBigInteger::fromHex("0000"));
+
+    std::string padded(24, ' ');
+    value.toHex(padded);
+    EXPECT_EQ("00000102030405060708090a", padded);
+
+    const UnsignedBigInteger p("115792089210356248762697446949407573530086143415290314195533631308867097853951");
+    EXPECT_EQ("ffffffff00000001000000000000000000000000ffffffffffffffffffffffff", p.toHex());
+    EXPECT_EQ(p, UnsignedBigInteger::fromHex(p.toHex()));
+
+    std::string tooShort(18, ' ');
+    EXPECT_THROW(value.toHex(tooShort), std::overflow_error);
+    EXPECT_THROW(UnsignedBigInteger::fromHex(""), std::invalid_argument);
+    EXPECT_THROW(UnsignedBigInteger::fromHex("0x12"), std::invalid_argument);
+    EXPECT_THROW(UnsignedBigInteger::fromHex("12 3"), std::invalid_argument);
+}
+
+
+TEST(UnsignedBigIntegerTest, decimal) {
+    std::mt19937_64 generator(42);
+
+    // Sizes around the chunk size and the split threshold
+    for (size_t size : {1, 9, 10, 19, 20, 100, 999, 1000, 1001, 3000, 3001, 9000}) {
+        std::string decimal(size, '0');
+        for (char &character : decimal) {
+            character = static_cast<char>('0' + generator() % 10);
+        }
+        decimal[0] = static_cast<char>('1' + generator() % 9);
+
+        // Reference: one multiply-add by 10 per character
+        UnsignedBigInteger expected(0);
+        for (char character : decimal) {
+            expected = expected * UnsignedBigInteger(10) + UnsignedBigInteger(character - '0');
+        }
+
+        const UnsignedBigInteger value = UnsignedBigInteger::fromDecimal(decimal);
+        EXPECT_EQ(expected, value);
+        EXPECT_EQ(decimal, value.to_string());
+        EXPECT_EQ(value, UnsignedBigInteger::fromDecimal("000" + decimal));
+    }
+
+    // Powers of ten, whose quotients and remainders are made of zeros
+    UnsignedBigInteger power(1);
+    for (size_t exponent = 0; exponent < 2400; ++exponent, power *= UnsignedBigInteger(10)) {
+        if (exponent % 37 == 0 || exponent > 2300) {
+            EXPECT_EQ("1" + std::string(exponent, '0'), power.to_string());
+            EXPECT_EQ(std::string(exponent, '9'), (power - UnsignedBigInteger(1)).to_string().substr(exponent ? 0 : 1));
+        }
+    }
+
+    const UnsignedBigInteger large = randomUnsignedBigInteger(generator, 2000);
+    EXPECT_EQ(large, UnsignedBigInteger(large.to_string()));
+
+    std::istringstream stream("  12345678901234567890 x");
+    UnsignedBigInteger parsed;
+    stream >> parsed;
+    EXPECT_EQ(UnsignedBigInteger("12345678901234567890"), parsed);
+    EXPECT_EQ(UnsignedBigInteger(7), UnsignedBigInteger(" 7"));
+    EXPECT_EQ("0", UnsignedBigInteger(0).to_string());
+    EXPECT_THROW(UnsignedBigInteger::fromDecimal(""), std::invalid_argument);
+    EXPECT_THROW(UnsignedBigInteger::fromDecimal("12a"), std::invalid_argument);
+    EXPECT_THROW(UnsignedBigInteger("12 "), std::runtime_error);
+}